@@ -8,8 +8,8 @@
 
 # The version number of the app ($(VMAJ).$(VMIN).$(VREV))
 VMAJ = 0
-VMIN = 6
-VREV = 1
+VMIN = 7
+VREV = 0
 VDEB = 1
 
 # the utility library
@@ -20,3 +20,10 @@ INC_SMXUTILS = -I/usr/include/smx/libsmxutils-0.4
 
 # the name of the application
 APPNAME = smxc
+
+# enable the option '-j' to flatten net instances on several threads. This
+# requires igraph to be built thread-safe (configure --enable-tls), hence the
+# option is only enabled if the igraph headers report so.
+IGRAPH_THREADING = /usr/include/igraph/igraph_threading.h
+THREAD_FLAGS = $(if $(shell grep -s "define IGRAPH_THREAD_SAFE 1" \
+			   $(IGRAPH_THREADING)),-DSMXC_THREADS -pthread)
@@ -10,16 +10,26 @@
 #define AST_H
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <time.h>
 
+// alignment of all allocations from the AST pool
+#define AST_POOL_ALIGN      16
+// minimal size of an AST pool chunk in bytes
+#define AST_POOL_CHUNK_SIZE 65536
+// pointer to the payload which is allocated inline after an AST node
+#define AST_PAYLOAD( node ) ( ( void* )( ( node ) + 1 ) )
+
 // TYPEDEFS -------------------------------------------------------------------
 typedef struct ast_assign_s ast_assign_t;   /**< ::ast_assign_s */
 typedef struct ast_attr_s ast_attr_t;       /**< ::ast_attr_s */
 typedef struct ast_box_s ast_box_t;         /**< ::ast_box_s */
+typedef struct ast_farm_s ast_farm_t;       /**< ::ast_farm_s */
 typedef struct ast_list_s ast_list_t;       /**< ::ast_list_s */
 typedef struct ast_net_s ast_net_t;         /**< ::ast_net_s */
 typedef struct ast_node_s ast_node_t;       /**< ::ast_node_s */
 typedef struct ast_op_s ast_op_t;           /**< ::ast_op_s */
+typedef struct ast_pool_s ast_pool_t;       /**< ::ast_pool_s */
 typedef struct ast_port_s ast_port_t;       /**< ::ast_port_s */
 typedef struct ast_prog_s ast_prog_t;       /**< ::ast_prog_s */
 typedef struct ast_prot_s ast_prot_t;       /**< ::ast_prot_s */
@@ -90,6 +100,7 @@ enum node_type_e
     AST_TT,
     AST_RT,
     AST_TF,
+    AST_FARM,
     AST_WRAP,
     AST_ATTR,
     AST_ID
@@ -137,6 +148,16 @@ struct ast_box_s
     ast_node_t*   attr_location;     /**< ::ast_attr_t */
 };
 
+/**
+ * @brief   AST structure of node type AST_FARM
+ */
+struct ast_farm_s
+{
+    int             line;   /**< the line number of the operation */
+    int             width;  /**< number of replicas */
+    ast_node_t*     op;     /**< ::ast_symb_t, ::ast_op_t */
+};
+
 /**
  * @brief   AST structure of linked list (AST_STMTS, AST_PORTS)
  */
@@ -165,6 +186,7 @@ struct ast_node_s
         ast_attr_t*     attr;       /**< AST_ATTR */
         ast_box_t*      box;        /**< AST_BOX */
         ast_assign_t*   assign;     /**< AST_ASSIGN */
+        ast_farm_t*     farm;       /**< AST_FARM */
         ast_list_t*     list;       /**< AST_STMTS, AST_PORTS */
         ast_prot_t*     proto;      /**< AST_NET_PROT */
         ast_net_t*      network;    /**< AST_NET */
@@ -189,11 +211,30 @@ struct ast_symb_s
 
 /**
  * @brief   AST structure of node types AST_SERIAL and AST_PARALLEL
+ *
+ * A chain of the same operator is stored as one n-ary node holding all
+ * operands in source order.
  */
 struct ast_op_s
 {
-    ast_node_t*   left;     /**< ::ast_symb_t, ::ast_net_t, ::ast_op_t */
-    ast_node_t*   right;    /**< ::ast_symb_t, ::ast_net_t, ::ast_op_t */
+    ast_list_t*   ops;      /**< operands (::ast_symb_t, ::ast_net_t,
+                                 ::ast_op_t) */
+    ast_list_t*   last;     /**< last element of the operand list */
+};
+
+/**
+ * @brief   A chunk of the AST memory pool
+ *
+ * All AST nodes, their payloads, list elements, and identifier names of a
+ * parse are bump-allocated from a linked list of chunks and are released at
+ * once.
+ */
+struct ast_pool_s
+{
+    char*       data;   /**< memory of the chunk */
+    size_t      size;   /**< size of the chunk in bytes */
+    size_t      used;   /**< number of allocated bytes */
+    ast_pool_t* next;   /**< pointer to the previously filled chunk */
 };
 
 /**
@@ -208,6 +249,7 @@ struct ast_port_s
     ast_node_t* mode;       /**< ::ast_attr_t */
     ast_node_t* coupling;   /**< ::ast_attr_t */
     ast_node_t* ch_len;     /**< ::ast_attr_t, length of the channel */
+    ast_node_t* msg_size;   /**< ::ast_attr_t, size of a message in bytes */
     ast_node_t* connection; /**< ::ast_attr_t */
 };
 
@@ -283,6 +325,16 @@ ast_node_t* ast_add_attr( int val, attr_type_t type );
 ast_node_t* ast_add_box( ast_node_t* id, ast_node_t* ports, ast_node_t* state,
         ast_node_t* ext );
 
+/**
+ * @brief   Add a replicated net (farm) to the AST.
+ *
+ * @param op    a pointer to the replicated operand
+ * @param width the number of replicas
+ * @param line  line number of the operator
+ * @return      a pointer to the location where the data was stored
+ */
+ast_node_t* ast_add_farm( ast_node_t* op, int width, int line );
+
 /**
  * @brief   Add a list as node to the AST.
  *
@@ -317,9 +369,25 @@ ast_node_t* ast_add_net( ast_node_t* node );
  */
 ast_node_t* ast_add_node( node_type_t type );
 
+/**
+ * @brief   Add a node with an inline payload to the AST.
+ *
+ * The payload of the given size is allocated together with the node and can
+ * be accessed with AST_PAYLOAD().
+ *
+ * @param type  type of AST node
+ * @param size  size of the payload in bytes
+ * @return      a pointer to the location where the data was stored
+ */
+ast_node_t* ast_add_node_inline( node_type_t type, size_t size );
+
 /**
  * @brief   Add a an operation to the AST.
  *
+ * If the left operand is an operation of the same type the right operand is
+ * appended to its operand list instead of creating a new node. This keeps
+ * long chains flat as all operators are left-associative.
+ *
  * @param left   pointer to the left operand
  * @param right  pointer to the right operand
  * @param type   AST_SERIAL, AST_PARALLEL
@@ -336,13 +404,15 @@ ast_node_t* ast_add_op( ast_node_t* left, ast_node_t* right, node_type_t type );
  * @param mode          pointer to the mode node
  * @param coupling      pointer to the coupling node
  * @param channel_len   the length of the channel
+ * @param msg_size      the size of a message in bytes
  * @param connection    pointer to the connection_attr node
  * @param type          PORT_BOX, PORT_NET, PORT_SYNC
  * @return              a pointer to the location where the data was stored
  */
 ast_node_t* ast_add_port( ast_node_t* id, ast_node_t* int_id,
         ast_node_t* collection, ast_node_t* mode, ast_node_t* coupling,
-        ast_node_t* channel_len, ast_node_t* connection, port_type_t type );
+        ast_node_t* channel_len, ast_node_t* msg_size, ast_node_t* connection,
+        port_type_t type );
 
 /**
  * @brief   Add a program node to the AST.
@@ -365,7 +435,7 @@ ast_node_t* ast_add_proto( ast_node_t* id, ast_node_t* ports );
 /**
  * @brief   Add a symbol to the AST.
  *
- * @param name  name of the symbol
+ * @param name  name of the symbol, allocated with ast_strdup()
  * @param line  line number of occurrence of the symbol
  * @param type  type of the symbol
  * @return      a pointer to the location where the data was stored
@@ -401,10 +471,32 @@ ast_node_t* ast_add_wrap( ast_node_t* id, ast_node_t* ports_wrap,
  * @brief   Destroy the AST
  *
  * Destroy the complete ast structure including all subnodes and leaf
- * nodes. This is a recursive function.
+ * nodes. The whole pool of the parse is released at once, hence no node of
+ * the tree may be used afterwards.
  *
  * @param ast   pointer to the root node of the ast
  */
 void ast_destroy( ast_node_t* ast );
 
+/**
+ * @brief   Allocate memory from the AST pool
+ *
+ * @param size  number of bytes to allocate
+ * @return      pointer to the allocated memory, aligned to #AST_POOL_ALIGN
+ */
+void* ast_pool_alloc( size_t size );
+
+/**
+ * @brief   Release all memory of the AST pool
+ */
+void ast_pool_destroy();
+
+/**
+ * @brief   Copy a string into the AST pool
+ *
+ * @param str   the string to copy
+ * @return      pointer to the copy
+ */
+char* ast_strdup( const char* str );
+
 #endif /* AST_H */
@@ -12,6 +12,7 @@
 #include <stdbool.h>
 #include <igraph.h>
 #include "ast.h"
+#include "smxhier.h"
 #include "vnet.h"
 #include "insttab.h"
 #include "symtab.h"
@@ -81,6 +82,36 @@ void check_connection_cp_net( virt_port_t* port1, virt_port_t* port2,
 void check_connection_missing( virt_net_t* v_net_l, virt_net_t* v_net_r,
         igraph_t* g, bool is_prop );
 
+/**
+ * @brief   Collect the vertices close to a vertex
+ *
+ * Collects all vertices which are at most #CONST_CON_DIST channels away from
+ * a vertex. A channel between two routing nodes of a farm does not count,
+ * such that a chain of farm routing nodes counts as one routing node.
+ *
+ * @param g             pointer to the dependency graph
+ * @param id            the id of the vertex to start from
+ * @param mode          the direction of the channels to follow
+ * @param has_farm_rn   true if the graph has farm routing nodes
+ * @param reach         pointer to an initialised vector which will hold the
+ *                      sorted ids of the collected vertices
+ */
+void check_connection_missing_reach( igraph_t* g, int id,
+        igraph_neimode_t mode, bool has_farm_rn, igraph_vector_t* reach );
+
+/**
+ * @brief   Check whether the message sizes of two connected ports agree
+ *
+ * Reports an error if both ports declare a message size and the sizes differ.
+ * A port of a copy synchronizer without a message size adopts the size of the
+ * other port such that it is propagated to all channels of the synchronizer.
+ *
+ * @param port_l    pointer to the port of a virtual net of the left operator
+ * @param port_r    pointer to the port of a virtual net of the right operator
+ * @return          true if the sizes agree, false otherwise
+ */
+bool check_connection_msg_size( virt_port_t* port_l, virt_port_t* port_r );
+
 /**
  * Check whether a port is declared as open in a connections of two ports.
  *
@@ -139,11 +170,18 @@ void check_connections_self( igraph_t* g, virt_net_t* v_net );
 /**
  * @brief    Check the context of all identifiers in the program
  *
+ * If an error was reported the top-level net is neither flattened nor post
+ * processed and \p g remains empty.
+ *
  * @param ast       pointer to the root ast node
  * @param symtab    pointer to the symbol table
  * @param g         pointer to an initialized igraph object
+ * @param hier      pointer to a hierarchical view to be created from the
+ *                  unflattened top-level net or NULL if not required. Use
+ *                  smxhier_destroy() to free it.
  */
-void check_context( ast_node_t* ast, symrec_t** symtab, igraph_t* g );
+void check_context( ast_node_t* ast, symrec_t** symtab, igraph_t* g,
+        hier_t* hier );
 
 /**
  * @brief    Step wise context checker
@@ -184,6 +222,33 @@ bool check_cpsync_merge_post_connect( igraph_t* g, int eid );
 bool check_cpsync_merge( double v1_out, double v1_in, double v2_out,
         double v2_in, bool l2r, bool r2l );
 
+/**
+ * @brief   check if all channels of each routing node carry the same message
+ *          size
+ *
+ * Must be called after post_process_msg_size(). Nothing is done if no port of
+ * the program declares a message size.
+ *
+ * @param g pointer to the dependancy graph
+ */
+void check_msg_size_cp( igraph_t* g );
+
+/**
+ * @brief   Get the line of the port which declares the message size of a
+ *          routing node
+ *
+ * Routing nodes have no position in the source file. Starting at the routing
+ * node, the connected routing nodes are searched for the closest box port of
+ * a channel with the given message size. The size was propagated from this
+ * port by post_process_msg_size().
+ *
+ * @param g     pointer to the dependancy graph
+ * @param vid   id of the routing node
+ * @param size  the message size
+ * @return      the line of the port declaration or 0 if no such port exists
+ */
+int check_msg_size_cp_line( igraph_t* g, int vid, int size );
+
 /**
  * @brief   check if a net has at least one triggering input
  *
@@ -234,6 +299,20 @@ bool check_single_mode_cp( igraph_t* g, int id );
 void connect_ports( virt_port_t* port_l, virt_port_t* port_r, igraph_t* g,
         bool connect_sync );
 
+/**
+ * @brief   Connect a port to a copy synchronizer
+ *
+ * A box port is connected like with connect_ports(). The port of a dispatcher
+ * or a collector of a farm is connected like a box port, i.e. the copy
+ * synchronizer feeds the dispatcher or is fed by the collector, and the port
+ * is marked as connected.
+ *
+ * @param port_cp   pointer to the port of the copy synchronizer
+ * @param port      pointer to a box port or a port of a farm routing node
+ * @param g         pointer to the dependency graph
+ */
+void connect_ports_cp( virt_port_t* port_cp, virt_port_t* port, igraph_t* g );
+
 /**
  * @brief   Merge two copy synchronizer
  *
@@ -280,13 +359,13 @@ bool do_port_cnts_match( symrec_list_t* r_ports, virt_port_list_t* v_ports );
  * @brief   Check whether port attributes from two port lists match
  *
  * Check whether each element on one list has a matching element in the
- * other list
+ * port list of a net. Only ports which are not connected are considered.
  *
  * @param r_ports   port list from a symbol record
- * @param v_ports   port list from a net
+ * @param v_net     pointer to the virtual net
  * @return          true if port attributes match, false if not
  */
-bool do_port_attrs_match( symrec_list_t* r_ports, virt_port_list_t* v_ports );
+bool do_port_attrs_match( symrec_list_t* r_ports, virt_net_t* v_net );
 
 /**
  * Get the priority of the time-critical net.
@@ -304,7 +383,9 @@ int get_time_criticality_prio( time_criticality_t tc, bool is_single );
  * - check whether the given identificator is in the symbol table
  * - add instances to the instance table
  * - add instances to the dependency graph
- * This is a recursive function.
+ * The operands of a serial or parallel operation are installed iteratively
+ * and combined from left to right. The function only recurses on nested
+ * operations of a different type.
  *
  * @param symtab        pointer to the symbol table
  * @param scope_stack   pointer to the scope stack
@@ -317,6 +398,78 @@ int get_time_criticality_prio( time_criticality_t tc, bool is_single );
 virt_net_t* install_nets( symrec_t** symtab, UT_array* scope_stack,
         ast_node_t* ast, igraph_t* g, time_criticality_t tc );
 
+/**
+ * @brief   Install the replicas of a farm
+ *
+ * The operand is installed once per replica. Each open input port of the
+ * replicas is connected to a new dispatcher and each open output port to a
+ * new collector (see install_nets_farm_rn()). Side ports are connected by copy
+ * synchronizers as with the parallel operator AST_PARALLEL. Each vertex of a
+ * replica gets a new farm id (see dgraph_farm_add()) in #GV_FARM and the index
+ * of its replica in #GV_REPLICA. Vertices of a nested farm keep their farm and get
+ * the farm and the replica in #GV_FARM_OUTER and #GV_REPLICA_OUTER instead.
+ *
+ * @param symtab        pointer to the symbol table
+ * @param scope_stack   pointer to the scope stack
+ * @param ast           pointer to the ast node of type AST_FARM
+ * @param g             pointer to the net graph
+ * @param tc            the type of time criticality of the net
+ * @return              pointer to the combined virtual net or NULL on failure
+ */
+virt_net_t* install_nets_farm( symrec_t** symtab, UT_array* scope_stack,
+        ast_node_t* ast, igraph_t* g, time_criticality_t tc );
+
+/**
+ * @brief   Add a dispatcher or a collector to a farm
+ *
+ * The routing node is a copy synchronizer vertex with the attribute
+ * #GV_FARM_RN set to #FARM_RN_DISPATCH for input ports and #FARM_RN_COLLECT
+ * for output ports. It gets the implementation #TEXT_FARM_DISPATCH or
+ * #TEXT_FARM_COLLECT and is neither merged with copy synchronizers nor
+ * reduced.
+ *
+ * @param ports     the current port list element of each replica, all
+ *                  pointing to the same port of the operand
+ * @param width     the number of replicas
+ * @param g         pointer to the net graph
+ * @param farm      the id of the farm
+ * @param tc        the type of time criticality of the net
+ * @return          pointer to the port of the routing node
+ */
+virt_port_t* install_nets_farm_rn( virt_port_list_t** ports, int width,
+        igraph_t* g, int farm, time_criticality_t tc );
+
+/**
+ * @brief   Combine two virtual nets with a parallel operator
+ *
+ * Both input nets are destroyed (shallow).
+ *
+ * @param v_net1    pointer to the virtual net of the left operand
+ * @param v_net2    pointer to the virtual net of the right operand
+ * @param g         pointer to the net graph
+ * @param type      AST_PARALLEL or AST_PARALLEL_DET
+ * @param tc        the type of time criticality of the net
+ * @return          pointer to the combined virtual net
+ */
+virt_net_t* install_nets_parallel( virt_net_t* v_net1, virt_net_t* v_net2,
+        igraph_t* g, node_type_t type, time_criticality_t tc );
+
+/**
+ * @brief   Combine two virtual nets with a serial operator
+ *
+ * The ports of both nets are connected and the combined virtual net is
+ * created. Both input nets are destroyed (shallow).
+ *
+ * @param v_net1    pointer to the virtual net of the left operand
+ * @param v_net2    pointer to the virtual net of the right operand
+ * @param g         pointer to the net graph
+ * @param type      AST_SERIAL or AST_SERIAL_PROP
+ * @param tc        the type of time criticality of the net
+ * @return          pointer to the combined virtual net
+ */
+virt_net_t* install_nets_serial( virt_net_t* v_net1, virt_net_t* v_net2,
+        igraph_t* g, node_type_t type, time_criticality_t tc );
+
 /**
  * @brief   checks wheter two instances are connected
  *
@@ -334,8 +487,81 @@ bool is_connected( instrec_t* rec1, instrec_t* rec2, igraph_t* g );
  * @param g pointer to the dependancy graph
  */
 void post_process( igraph_t* g );
+
+/**
+ * @brief   move the decoupling of channels to the last routing node of a path
+ *
+ * A decoupled channel leading into a routing node is coupled and all output
+ * channels of the routing node are decoupled instead. Channels between routing
+ * nodes pass the decoupling on to the next routing node. This is computed in
+ * one traversal of the reached routing nodes where each routing node is
+ * visited at most once.
+ *
+ * @param g pointer to the dependancy graph
+ */
+void post_process_decoupling( igraph_t* g );
+
+/**
+ * @brief   Mark the channels of farms
+ *
+ * The farms are numbered from 1 in the order of the vertices. Each output
+ * channel of a dispatcher and each input channel of a collector gets the id of
+ * the farm in #GE_FARM and the index of the replica at the other end in
+ * #GE_REPLICA such that the runtime can dispatch messages to one replica at a
+ * time and collect them in order. All other channels and vertices get the farm
+ * id 0. Nothing is done if the program has no farm.
+ *
+ * @param g pointer to the dependancy graph
+ */
+void post_process_farm( igraph_t* g );
+
+/**
+ * @brief   Merge connected copy synchronizers until no merge is possible
+ *
+ * All channels of the graph are checked, starting over after each merge.
+ *
+ * @param g pointer to the dependancy graph
+ */
 void post_process_merge( igraph_t* g );
 
+/**
+ * @brief   Merge the copy synchronizers at both ends of a channel if possible
+ *
+ * The channel is removed if the copy synchronizers are merged.
+ *
+ * @param g     pointer to the dependancy graph
+ * @param eid   id of the channel
+ * @return      true if the copy synchronizers were merged, false otherwise
+ */
+bool post_process_merge_edge( igraph_t* g, int eid );
+
+/**
+ * @brief   Merge copy synchronizers connected by channels added since the
+ *          last call
+ *
+ * The number of channels checked is kept in the graph attribute
+ * #GG_MERGE_ECNT. Adding channels only increases the degree of routing nodes,
+ * which never makes a channel mergeable that was not mergeable before. Hence,
+ * only the new channels are checked. The first merge falls back to
+ * post_process_merge(). Removing vertices or channels clears the mark, see
+ * dgraph_merge_mark_clear().
+ *
+ * @param g pointer to the dependancy graph
+ */
+void post_process_merge_new( igraph_t* g );
+
+/**
+ * @brief   Propagate the declared message sizes of channels
+ *
+ * Channels without a declared message size get the size of the other channels
+ * of the routing node they are connected to, or 0 if none is known. Conflicts
+ * are reported by check_msg_size_cp(). Nothing is done if no port of the
+ * program declares a message size.
+ *
+ * @param g pointer to the dependancy graph
+ */
+void post_process_msg_size( igraph_t* g );
+
 /**
  * Helper function to propagate decoupleing attributes when merging routing
  * nodes.
@@ -28,11 +28,21 @@
 /* #define DEBUG_SEARCH_PORT_WRAP */
 /* #define DEBUG_SEARCH_PORT_CHILD */
 /* #define DEBUG_LINK_DOT */
+/* #define DEBUG_FUSE_RN */
+/* #define DEBUG_FUSE_PURE */
 #endif
 
 // constants
 #define CONST_SCOPE_LEN 9
 #define CONST_ID_LEN 9
+#define CONST_SCHED_MAX_RELEASES 65536
+#define CONST_FARM_MAX_WIDTH 4096
+// two nets are connected if they are at most this many channels apart, i.e.
+// directly or through one routing node
+#define CONST_CON_DIST 2
+
+// separator of implementation names of fused boxes
+#define TEXT_IMPL_SEP ","
 
 typedef enum time_criticality_e
 {
@@ -89,6 +99,72 @@ enum parse_attr_e
     PARSE_ATTR_NET
 };
 
+/**
+ * @brief   Channel classes defined by the number of producers and consumers
+ */
+enum channel_class_e
+{
+    CHANNEL_CLASS_SPSC,     /**< single producer, single consumer */
+    CHANNEL_CLASS_MPSC,     /**< multiple producers, single consumer */
+    CHANNEL_CLASS_SPMC,     /**< single producer, multiple consumers */
+    CHANNEL_CLASS_MPMC      /**< multiple producers, multiple consumers */
+};
+
+/**
+ * @brief   Routing nodes of farms
+ */
+enum farm_rn_e
+{
+    FARM_RN_NONE,       /**< not a routing node of a farm */
+    FARM_RN_DISPATCH,   /**< passes each message to one replica */
+    FARM_RN_COLLECT     /**< collects the messages of all replicas */
+};
+
+// graph attributes which are not (yet) part of libsmxutils
+#define GE_CLASS        "class"
+#define GE_DEC          "decoupled"
+#define GV_FANIN        "fanin"
+#define GV_FANOUT       "fanout"
+#define GV_PRIO         "prio"
+#define GV_TEMPLATE     "template"
+#define GE_PSRC_NAME    "srcport"
+#define GE_PDST_NAME    "dstport"
+#define GG_PORTS        "ports"
+#define GE_COUNT        "count"
+#define GE_MSG_SIZE     "msgsize"
+#define GE_MEM_WR       "memwr"
+#define GE_MEM_RD       "memrd"
+#define GE_MEM_BUF      "membuf"
+#define GG_MEM_ARENA    "memarena"
+#define GV_ORIG_ID      "origid"
+#define GE_ORIG_ID      "origid"
+#define GV_FARM         "farm"
+#define GV_REPLICA      "replica"
+#define GV_FARM_OUTER   "farmouter"
+#define GV_REPLICA_OUTER    "replicaouter"
+#define GV_FARM_RN      "farmrn"
+#define GE_FARM         "farm"
+#define GE_REPLICA      "replica"
+#define GV_PATH         "path"
+#define GG_MERGE_ECNT   "mergeecnt"
+
+// implementations of the routing nodes of farms
+#define TEXT_FARM_DISPATCH  "smx_rn_dispatch"
+#define TEXT_FARM_COLLECT   "smx_rn_collect"
+
+// channel memory layout: cache line, huge page, slot alignment, and the
+// default message size (a pointer to the message)
+#define SMXMEM_CACHE_LINE   64
+#define SMXMEM_HUGE_PAGE    ( 2 * 1024 * 1024 )
+#define SMXMEM_ALIGN        8
+#define SMXMEM_MSG_SIZE     sizeof( void* )
+
+// output format of the C code generation backend
+#define G_FMT_C         "c"
+
+// folder of the net templates of the hierarchical output
+#define TPL_FOLDER      "tpl"
+
 #define SIA_BOX_INFIX   "_"
 #define SIA_PORT_INFIX  "_"
 
@@ -103,8 +179,14 @@ enum parse_attr_e
 #define N_CON_DOT_PATH  DOT_FOLDER "/net_connection_graph.dot"
 #define P_CON_DOT_PATH  DOT_FOLDER "/port_connection_graph.dot"
 #define TEMP_DOT_PATH   DOT_FOLDER "/graph.dot.tmp"
+#define C_CON_DOT_PATH  DOT_FOLDER "/collapsed_connection_graph.dot"
 #define DOT_PATTERN     "// ===>"
 
+// views of the dot export and the default vertex budget of a dot file
+#define DOT_VIEW_INST       "inst"
+#define DOT_VIEW_COLLAPSED  "collapsed"
+#define DOT_MAX_VERTICES    5000
+
 #define SHAPE_BOX       "box"
 #define SHAPE_ELLIPSE   "ellipse"
 #define SHAPE_OCTAGON   "octagon"
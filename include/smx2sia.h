@@ -12,6 +12,20 @@
 #include "sia.h"
 #include "igraph.h"
 #include "vnet.h"
+#include "smxz.h"
+#include "uthash.h"
+
+typedef struct smx2sia_port_s smx2sia_port_t;   /**< ::smx2sia_port_s */
+
+/**
+ * @brief   A port of a box signature, hashed by name to bind SIA actions
+ */
+struct smx2sia_port_s
+{
+    const char*     name;   /**< name of the port, hash key */
+    char*           action; /**< action name of the port in the box instance */
+    UT_hash_handle  hh;     /**< makes this structure hashable */
+};
 
 /**
  * @brief Generate SIAs for all boxes
@@ -42,6 +56,39 @@ void smx2sia( igraph_t* g, sia_t** smx_symbs, sia_t** desc_symbs );
 void smx2sia_add_transition( igraph_t* g, virt_port_t* port, int id_src,
         int id_dst, int vid );
 
+/**
+ * @brief Compare two SIAs by their streamix name
+ *
+ * Used to sort the table of contents of the archive.
+ *
+ * @param a         pointer to a pointer to a SIA
+ * @param b         pointer to a pointer to a SIA
+ * @return          the result of strcmp of the two names
+ */
+int smx2sia_archive_cmp( const void* a, const void* b );
+
+/**
+ * @brief Write all SIAs to a single archive
+ *
+ * The archive starts with the header line
+ * `SMXSIA <version> <count> <format> <raw|gz> <entry_len>` followed by a
+ * table of contents with one entry `<offset> <size> <smx_name>` per SIA. The
+ * entries are sorted by name and padded to `entry_len` bytes such that a
+ * single SIA is found by bisection with smxz_read_archive(). Offset and
+ * size are zero padded to #SIA_ARCHIVE_NUM_LEN digits and refer to the byte
+ * position of the graph in the archive. The graphs follow the table of
+ * contents. If the archive is compressed each graph is a separate gzip member
+ * such that it can be inflated on its own.
+ *
+ * @param symbols   pointer to the symbol table of sias
+ * @param path      path to the archive
+ * @param format    format string, either 'gml' or 'graphml'
+ * @param compress  if true, each graph is deflated
+ * @return          the number of written SIAs or -1 on failure
+ */
+int smx2sia_archive_write( sia_t** symbols, const char* path,
+        const char* format, bool compress );
+
 /**
  * @brief Set the streamix name of a SIA
  *
@@ -85,9 +132,11 @@ void smx2sia_sias_destroy( sias_t* sias, sia_t** desc_symbols,
  * @param symbols   pointer to the symbol table of sias
  * @param out_path  output path where the files will be stored
  * @param format    format string, either 'gml' or 'graphml'
+ * @param compress  if true, each graph is deflated while it is written to
+ *                  `out_path/NAME.FORMAT.gz`
  */
 void smx2sia_sias_write( sia_t** symbols, const char* out_path,
-        const char* format );
+        const char* format, bool compress );
 
 /**
  * @brief Check and update user defined SIAs
@@ -98,6 +147,10 @@ void smx2sia_sias_write( sia_t** symbols, const char* out_path,
  *  - the SIA name is changed to <box_name><infix><box_implementation_name>
  *  - the action names are changed to <port_name><infix><edge_id>
  *
+ * The ports of the signature are hashed by name and the action name of each
+ * port is created once, such that each transition is bound with a single
+ * lookup.
+ *
  * @param g         pointer to the user defined SIA graph
  * @param ports_rec pointer to the signature of the box
  * @param vid       unique id ( vertex id of the dependency graph)
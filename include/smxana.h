@@ -0,0 +1,348 @@
+/**
+ * Analysis passes on the flattened dependency graph
+ *
+ * @file    smxana.h
+ * @author  Simon Maurer
+ *
+ */
+
+#ifndef SMXANA_H
+#define SMXANA_H
+
+// TYPEDEFS -------------------------------------------------------------------
+typedef struct wcet_s wcet_t;               /**< ::wcet_s */
+typedef struct latency_s latency_t;         /**< ::latency_s */
+typedef struct release_s release_t;         /**< ::release_s */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <igraph.h>
+#include "uthash.h"
+#include "vnet.h"
+
+// STRUCTS --------------------------------------------------------------------
+/**
+ * @brief   Worst-case execution time of a box implementation
+ */
+struct wcet_s
+{
+    char*           name;   /**< implementation or box name, hash key */
+    uint64_t        time;   /**< worst-case execution time in nanoseconds */
+    UT_hash_handle  hh;     /**< makes this structure hashable */
+};
+
+/**
+ * @brief   Release of a time-triggered box at an offset of the hyperperiod
+ */
+struct release_s
+{
+    uint64_t    offset; /**< release offset in nanoseconds */
+    int         vid;    /**< vertex id of the released box */
+};
+
+/**
+ * @brief   Result of the latency analysis
+ */
+struct latency_s
+{
+    int         v_count;        /**< number of vertices */
+    int         e_count;        /**< number of edges */
+    int*        out_idx;        /**< start index of the out-edges of each
+                                     vertex in out_eids (size v_count + 1) */
+    int*        out_eids;       /**< out-edge ids grouped by source vertex */
+    uint64_t*   cost;           /**< execution cost of each vertex */
+    uint64_t*   delay;          /**< queueing delay of each edge */
+    uint64_t*   dist;           /**< worst-case latency up to each vertex */
+    uint64_t*   period;         /**< tt period of each vertex or 0 */
+    uint64_t*   span;           /**< cost of the tt path starting at each
+                                     vertex, 0 inside a tt path */
+    int*        pred;           /**< predecessor edge on the longest path */
+    int*        source;         /**< source vertex of the longest path */
+    bool*       is_feedback;    /**< true if an edge closes a cycle */
+    bool*       has_wcet;       /**< true if a WCET was provided for a box */
+    int         feedback_cnt;   /**< number of feedback edges */
+    int         missing_cnt;    /**< number of boxes without WCET */
+    int         critical;       /**< sink vertex of the critical path */
+};
+
+// FUNCTIONS ------------------------------------------------------------------
+
+/**
+ * @brief   Count the boxes reachable from a vertex through routing nodes
+ *
+ * @param g     pointer to the dependency graph
+ * @param vid   id of the vertex
+ * @param mode  IGRAPH_IN to count the producers, IGRAPH_OUT to count the
+ *              consumers
+ * @param mark  array of size vcount used to mark visited vertices
+ * @param stamp a value not yet used in mark
+ * @return      1 if the vertex is a box, the number of boxes reached through
+ *              the routing node otherwise
+ */
+int smxana_channel_box_cnt( igraph_t* g, int vid, igraph_neimode_t mode,
+        int* mark, int stamp );
+
+/**
+ * @brief   Classify all channels of the dependency graph
+ *
+ * The class (::channel_class_e) of a channel is defined by its end points and
+ * stored in the edge attribute #GE_CLASS. Each end of a channel is one vertex
+ * of the flattened graph: a fan-in or a fan-out of boxes is a routing node
+ * which reads from or writes to each of its channels on its own. Hence every
+ * channel has a single producer and a single consumer.
+ *
+ * The number of boxes connected through the routing nodes is stored in the
+ * vertex attributes #GV_FANIN (the boxes writing to the channels leaving the
+ * vertex) and #GV_FANOUT (the boxes reading from the channels entering the
+ * vertex). Both are 1 for a box.
+ *
+ * The edge attribute #GE_DEC is set if either end of the channel is
+ * decoupled. Such a channel never blocks and may be implemented as an
+ * overwrite-latest slot instead of a FIFO.
+ *
+ * This function must be called on the flattened graph after post_process().
+ *
+ * @param g pointer to the dependency graph
+ */
+void smxana_channel_class( igraph_t* g );
+
+/**
+ * @brief   Write a string as a JSON string literal
+ *
+ * Quotes, backslashes, and control characters are escaped.
+ *
+ * @param out   file handler to write to
+ * @param str   the string to write
+ */
+void smxana_json_write_str( FILE* out, const char* str );
+
+/**
+ * @brief   Compute the worst-case latencies of the dependency graph
+ *
+ * The latency of a path is the sum of the execution costs of all vertices on
+ * the path and the queueing delays of all channels on the path. Boxes cost
+ * their WCET (0 if unknown), routing nodes cost nothing. A message may have
+ * to wait behind all other messages in the channel: if the consumer is
+ * time-triggered or time-bound the queueing delay is the channel length times
+ * the period of the consumer, otherwise it is the channel length minus one
+ * times the cost of the consumer. Decoupled channels are treated as channels
+ * of length one.
+ *
+ * Cycles are broken by ignoring feedback edges found by a depth-first search.
+ *
+ * All boxes of a tt net run within one period: a message entering the net
+ * waits for the release of the period, the boxes of the net then run one
+ * after the other. Hence the channels inside a tt net, i.e. channels which
+ * are timed at both ends, cause no queueing delay. The cost of a tt path is
+ * the sum of the costs of the vertices connected by such channels. It is
+ * checked against the period of the first vertex of the path.
+ *
+ * @param g         pointer to the flattened dependency graph
+ * @param wcets     pointer to the WCET hash table or NULL
+ * @param lat       pointer to the latency structure to fill. Use
+ *                  smxana_latency_destroy() to free its content.
+ */
+void smxana_latency( igraph_t* g, wcet_t* wcets, latency_t* lat );
+
+/**
+ * @brief   Free the content of a latency structure
+ *
+ * @param lat   pointer to the latency structure
+ */
+void smxana_latency_destroy( latency_t* lat );
+
+/**
+ * @brief   Mark the feedback edges of the graph
+ *
+ * An iterative depth-first search starting from all vertices in id order marks
+ * each edge pointing to a vertex on the current search path.
+ *
+ * @param g     pointer to the dependency graph
+ * @param lat   pointer to the latency structure where the marks are stored
+ */
+void smxana_latency_feedback( igraph_t* g, latency_t* lat );
+
+/**
+ * @brief   Check whether a vertex is a sink of the acyclic latency graph
+ *
+ * @param lat   pointer to the latency structure
+ * @param vid   id of the vertex
+ * @return      true if the vertex has no out-edges other than feedback edges
+ */
+bool smxana_latency_is_sink( latency_t* lat, int vid );
+
+/**
+ * @brief   Check whether a channel lies inside a tt net
+ *
+ * @param g     pointer to the flattened dependency graph
+ * @param eid   id of the channel
+ * @return      true if the channel is time-triggered at both ends
+ */
+bool smxana_latency_is_tt_inner( igraph_t* g, int eid );
+
+/**
+ * @brief   Print a human readable latency report
+ *
+ * @param g     pointer to the flattened dependency graph
+ * @param lat   pointer to the computed latency structure
+ */
+void smxana_latency_print( igraph_t* g, latency_t* lat );
+
+/**
+ * @brief   Write the latency report in JSON format
+ *
+ * @param g     pointer to the flattened dependency graph
+ * @param lat   pointer to the computed latency structure
+ * @param out   file handler to write to
+ */
+void smxana_latency_write( igraph_t* g, latency_t* lat, FILE* out );
+
+/**
+ * @brief   Print a time in the most suitable unit
+ *
+ * @param out   file handler to write to
+ * @param time  time in nanoseconds
+ */
+void smxana_print_time( FILE* out, uint64_t time );
+
+/**
+ * @brief   Propagate priorities of time-critical vertices to their producers
+ *
+ * A box or routing node feeding a vertex with a priority inherits this
+ * priority reduced by the decay. The effective priority of a vertex is the
+ * maximum of its own priority (#GV_TT) and all inherited priorities and is
+ * stored in the vertex attribute #GV_PRIO. Priorities are propagated with a
+ * worklist until no vertex can be raised any further.
+ *
+ * This function must be called on the flattened graph after post_process().
+ *
+ * @param g         pointer to the flattened dependency graph
+ * @param decay     the priority loss per channel
+ * @param from      array of size vcount, will hold the id of the vertex each
+ *                  raised vertex inherited its priority from or -1
+ * @return          the number of raised vertices
+ */
+int smxana_prio_inherit( igraph_t* g, int decay, int* from );
+
+/**
+ * @brief   Print the inheritance chain of each raised vertex
+ *
+ * @param g     pointer to the flattened dependency graph
+ * @param from  array computed by smxana_prio_inherit()
+ */
+void smxana_prio_print( igraph_t* g, int* from );
+
+/**
+ * @brief   Compare two releases by offset and vertex id (used by qsort)
+ *
+ * @param a     pointer to a ::release_s
+ * @param b     pointer to a ::release_s
+ * @return      <0, 0, >0 if a is released before, with, or after b
+ */
+int smxana_cmp_release( const void* a, const void* b );
+
+/**
+ * @brief   Find the group representative of a vertex (union-find)
+ *
+ * @param group array holding the parent of each vertex in the group forest
+ * @param vid   id of the vertex
+ * @return      id of the representative vertex of the group
+ */
+int smxana_group_find( int* group, int vid );
+
+/**
+ * @brief   Compute the greatest common divisor of two numbers
+ *
+ * @param a     first number
+ * @param b     second number
+ * @return      the greatest common divisor of a and b
+ */
+uint64_t smxana_gcd( uint64_t a, uint64_t b );
+
+/**
+ * @brief   Compute and write static cyclic schedules of time-triggered boxes
+ *
+ * Vertices connected by time-triggered channels form a time-triggered group.
+ * For each group the hyperperiod (the least common multiple of all box
+ * periods) is computed and each box is released at every multiple of its
+ * period within the hyperperiod. The schedule is written in JSON format and
+ * lists, per group, the release offsets of each box and the merged release
+ * table over the hyperperiod.
+ *
+ * @param g     pointer to the flattened dependency graph
+ * @param out   file handler to write to
+ * @return      the number of time-triggered groups
+ */
+int smxana_tt_schedule( igraph_t* g, FILE* out );
+
+/**
+ * @brief   Write the schedule of one time-triggered group in JSON format
+ *
+ * @param g         pointer to the flattened dependency graph
+ * @param group     array holding the group forest of all vertices
+ * @param period    array holding the period of each vertex
+ * @param id_group  id of the representative vertex of the group
+ * @param out       file handler to write to
+ */
+void smxana_tt_schedule_group( igraph_t* g, int* group, uint64_t* period,
+        int id_group, FILE* out );
+
+/**
+ * @brief   Get the period of a time-triggered vertex
+ *
+ * @param g     pointer to the dependency graph
+ * @param vid   id of the vertex
+ * @return      the smallest period of all time-triggered channels of the
+ *              vertex in nanoseconds or 0 if the vertex is not time-triggered
+ */
+uint64_t smxana_vertex_period( igraph_t* g, int vid );
+
+/**
+ * @brief   Destroy a WCET hash table
+ *
+ * @param wcets pointer to the hash table
+ */
+void smxana_wcet_destroy( wcet_t** wcets );
+
+/**
+ * @brief   Get the WCET of a box
+ *
+ * The WCET is searched by implementation name first and then by box name.
+ * The implementation name of a fused box lists several implementations in
+ * which case the WCETs of all stages are summed up.
+ *
+ * @param wcets     pointer to the WCET hash table
+ * @param impl      the implementation name of the box
+ * @param name      the name of the box
+ * @param time      pointer to a variable where the WCET is stored
+ * @return          true if a WCET was found for the box (or all of its
+ *                  stages), false otherwise
+ */
+bool smxana_wcet_get( wcet_t* wcets, const char* impl, const char* name,
+        uint64_t* time );
+
+/**
+ * @brief   Get the summed up WCET of a list of names
+ *
+ * @param wcets     pointer to the WCET hash table
+ * @param list      names separated by #TEXT_IMPL_SEP
+ * @param time      pointer to a variable where the sum is stored
+ * @return          true if a WCET was found for all names, false otherwise
+ */
+bool smxana_wcet_get_list( wcet_t* wcets, const char* list, uint64_t* time );
+
+/**
+ * @brief   Read a WCET side file
+ *
+ * Each line holds a box implementation name (or a box name) and a time. The
+ * time is an integer with an optional unit suffix `s`, `ms`, `us`, or `ns`
+ * (default). Empty lines and lines starting with `#` are ignored.
+ *
+ * @param path  path to the WCET file
+ * @param wcets pointer to the hash table to fill
+ * @return      0 on success, -1 if the file cannot be read or is malformed
+ */
+int smxana_wcet_read( const char* path, wcet_t** wcets );
+
+#endif // SMXANA_H
@@ -0,0 +1,103 @@
+/**
+ * Generate a C translation unit describing the static setup of the network
+ *
+ * @file    smxcgen.h
+ * @author  Simon Maurer
+ *
+ */
+
+#ifndef SMXCGEN_H
+#define SMXCGEN_H
+
+// TYPEDEFS -------------------------------------------------------------------
+typedef struct cgen_impl_s cgen_impl_t;     /**< ::cgen_impl_s */
+
+#include <stdio.h>
+#include <igraph.h>
+#include "uthash.h"
+
+// STRUCTS --------------------------------------------------------------------
+/**
+ * @brief   A box implementation symbol which must be declared once
+ */
+struct cgen_impl_s
+{
+    const char*     name;   /**< name of the implementation, hash key */
+    UT_hash_handle  hh;     /**< makes this structure hashable */
+};
+
+// FUNCTIONS ------------------------------------------------------------------
+
+/**
+ * @brief   Write the boxes and channels of the flattened graph as C code
+ *
+ * The generated translation unit defines the following static tables which
+ * the runtime can link directly instead of parsing the graph at start-up:
+ *  - `smx_cgen_boxes`: one box descriptor per vertex with its stages in the
+ *    stage table, the priority (#GV_PRIO if priorities were inherited, #GV_TT
+ *    otherwise), the attributes pure, static, and location, and the range of
+ *    its channels in the wiring tables.
+ *  - `smx_cgen_stages`: the implementation functions (#GV_IMPL) of all boxes,
+ *    grouped by box. A box has one stage, or one stage per box of the chain
+ *    it replaces if it was fused by smxopt_fuse_pure(). The stages of a box
+ *    are executed in order.
+ *  - `smx_cgen_channels`: one channel descriptor per edge with the length,
+ *    the decoupling, the timing, the dynamic flags, the class, and the ids of
+ *    the source and destination box.
+ *  - `smx_cgen_box_in` and `smx_cgen_box_out`: the channel ids of all input
+ *    and output ports, grouped by box.
+ *
+ * The descriptor types are defined in the generated file unless the runtime
+ * provides them and defines `SMX_CGEN_TYPES`. Implementation functions are
+ * declared `extern` such that they are resolved at link time.
+ *
+ * @param g         pointer to the flattened graph
+ * @param out_file  the stream to write to
+ * @param name      the name of the program, written to the file header
+ */
+void smxcgen_write( igraph_t* g, FILE* out_file, const char* name );
+
+/**
+ * @brief   Declare each implementation function of the graph once
+ *
+ * The implementation attribute of a fused box lists the implementations of
+ * all its stages, each of them is declared.
+ *
+ * @param g         pointer to the flattened graph
+ * @param out_file  the stream to write to
+ */
+void smxcgen_write_impls( igraph_t* g, FILE* out_file );
+
+/**
+ * @brief   Write the implementation functions of all stages, grouped by box
+ *
+ * @param g         pointer to the flattened graph
+ * @param out_file  the stream to write to
+ * @param first     array where the index of the first stage of each box is
+ *                  stored
+ * @param cnt       array where the number of stages of each box is stored
+ */
+void smxcgen_write_stages( igraph_t* g, FILE* out_file, int* first, int* cnt );
+
+/**
+ * @brief   Write the types of the box and channel descriptors
+ *
+ * @param out_file  the stream to write to
+ */
+void smxcgen_write_types( FILE* out_file );
+
+/**
+ * @brief   Write the channel ids of all ports of one direction, grouped by box
+ *
+ * @param g         pointer to the flattened graph
+ * @param out_file  the stream to write to
+ * @param name      the name of the wiring table
+ * @param mode      IGRAPH_IN for input ports or IGRAPH_OUT for output ports
+ * @param first     array where the index of the first channel of each box is
+ *                  stored
+ * @param cnt       array where the number of channels of each box is stored
+ */
+void smxcgen_write_wiring( igraph_t* g, FILE* out_file, const char* name,
+        igraph_neimode_t mode, int* first, int* cnt );
+
+#endif // SMXCGEN_H
@@ -0,0 +1,199 @@
+/**
+ * Change set between two flattened graphs for incremental redeploys
+ *
+ * @file    smxdiff.h
+ * @author  Simon Maurer
+ *
+ */
+
+#ifndef SMXDIFF_H
+#define SMXDIFF_H
+
+// TYPEDEFS -------------------------------------------------------------------
+typedef struct diff_attr_s diff_attr_t;     /**< ::diff_attr_s */
+typedef struct diff_key_s diff_key_t;       /**< ::diff_key_s */
+typedef struct diff_set_s diff_set_t;       /**< ::diff_set_s */
+typedef struct graph_diff_s graph_diff_t;   /**< ::graph_diff_s */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <igraph.h>
+#include "uthash.h"
+
+// STRUCTS --------------------------------------------------------------------
+/**
+ * @brief   Attribute which is compared between the two graphs
+ */
+struct diff_attr_s
+{
+    const char* name;   /**< name of the attribute */
+    int         type;   /**< igraph attribute type, the same in both graphs */
+};
+
+/**
+ * @brief   Stable key of a vertex or an edge
+ */
+struct diff_key_s
+{
+    char*           key;    /**< the key, hash key */
+    int             id;     /**< id of the vertex or edge, or number of uses */
+    UT_hash_handle  hh;     /**< makes this structure hashable */
+};
+
+/**
+ * @brief   Matching of the vertices or the edges of two graphs
+ */
+struct diff_set_s
+{
+    char**          keys;       /**< key of each element of the new graph */
+    char**          keys_old;   /**< key of each element of the old graph */
+    int*            match;      /**< id of the matching old element or -1 */
+    int*            match_old;  /**< id of the matching new element or -1 */
+    bool*           is_mod;     /**< true if the matching element changed */
+    int             cnt;        /**< number of elements in the new graph */
+    int             cnt_old;    /**< number of elements in the old graph */
+    int             added_cnt;      /**< number of added elements */
+    int             removed_cnt;    /**< number of removed elements */
+    int             modified_cnt;   /**< number of modified elements */
+    int             moved_cnt;      /**< number of unchanged elements with a
+                                         new id */
+    diff_attr_t*    attrs;      /**< attributes which are compared */
+    int             attr_cnt;   /**< number of compared attributes */
+    igraph_strvector_t names;   /**< attribute names of the new graph */
+    igraph_attribute_elemtype_t elem;   /**< vertices or edges */
+};
+
+/**
+ * @brief   Change set between two flattened graphs
+ */
+struct graph_diff_s
+{
+    igraph_t*   g_old;  /**< the previous graph */
+    igraph_t*   g;      /**< the new graph */
+    diff_set_t  v;      /**< matching of the vertices */
+    diff_set_t  e;      /**< matching of the edges */
+};
+
+// FUNCTIONS ------------------------------------------------------------------
+
+/**
+ * @brief   Collect the attributes both graphs hold with the same type
+ *
+ * The id of the elements, the instance path (#GV_PATH), and the previous id
+ * (#GV_ORIG_ID) are not compared.
+ *
+ * @param diff  pointer to the change set
+ * @param set   pointer to the vertex or edge set of the change set
+ */
+void smxdiff_attrs( graph_diff_t* diff, diff_set_t* set );
+
+/**
+ * @brief   Compare the attributes of a matching pair of elements
+ *
+ * @param diff      pointer to the change set
+ * @param set       pointer to the vertex or edge set of the change set
+ * @param id        id of the element in the new graph
+ * @param out       if not NULL, the names of the differing attributes are
+ *                  written as a JSON list to this stream
+ * @return          the number of differing attributes
+ */
+int smxdiff_cmp( graph_diff_t* diff, diff_set_t* set, int id, FILE* out );
+
+/**
+ * @brief   Compute the change set between two flattened graphs
+ *
+ * Vertices are matched by their instance path (#GV_PATH), i.e. the nesting of
+ * nets and wrappers and the line of each instance. Routing nodes are further
+ * identified by the paths and ports of their neighbours. Edges are matched by
+ * the keys of their endpoints and their label. Remaining duplicates are
+ * numbered in the order of their ids.
+ *
+ * @param g_old     pointer to the previous graph
+ * @param g         pointer to the new graph
+ * @param diff      pointer to the change set to fill in
+ * @return          0 on success, -1 if a graph holds no instance paths
+ */
+int smxdiff_compute( igraph_t* g_old, igraph_t* g, graph_diff_t* diff );
+
+/**
+ * @brief   Free the change set
+ *
+ * @param diff  pointer to the change set
+ */
+void smxdiff_destroy( graph_diff_t* diff );
+
+/**
+ * @brief   Compare two keys, used to sort the neighbours of routing nodes
+ *
+ * @param a     pointer to the first key
+ * @param b     pointer to the second key
+ * @return      a negative value, zero, or a positive value if a is sorted
+ *              before, equal to, or after b
+ */
+int smxdiff_key_cmp( const void* a, const void* b );
+
+/**
+ * @brief   Make a key unique by appending the number of its previous uses
+ *
+ * @param uses  pointer to the hash table counting the uses of keys
+ * @param key   the key, is freed if a new key is returned
+ * @return      the key or a newly allocated key with a suffix `#N`
+ */
+char* smxdiff_key_unique( diff_key_t** uses, char* key );
+
+/**
+ * @brief   Compute the keys of all edges of a graph
+ *
+ * The key of an edge is `SRC:LABEL>DST` where SRC and DST are the keys of the
+ * endpoints.
+ *
+ * @param g         pointer to the graph
+ * @param v_keys    the keys of the vertices of the graph
+ * @return          an array of allocated keys, one per edge
+ */
+char** smxdiff_keys_e( igraph_t* g, char** v_keys );
+
+/**
+ * @brief   Compute the keys of all vertices of a graph
+ *
+ * The key of a vertex is its instance path. The key of a routing node is its
+ * path followed by the sorted list of the paths and ports of its neighbours.
+ *
+ * @param g pointer to the graph
+ * @return  an array of allocated keys, one per vertex
+ */
+char** smxdiff_keys_v( igraph_t* g );
+
+/**
+ * @brief   Match the elements of the new graph to those of the old graph
+ *
+ * @param diff  pointer to the change set
+ * @param set   pointer to the vertex or edge set with the keys computed
+ */
+void smxdiff_match( graph_diff_t* diff, diff_set_t* set );
+
+/**
+ * @brief   Print a summary of the change set
+ *
+ * @param diff  pointer to the change set
+ */
+void smxdiff_print( graph_diff_t* diff );
+
+/**
+ * @brief   Write the change set as JSON
+ *
+ * @param diff  pointer to the change set
+ * @param out   the stream to write to
+ */
+void smxdiff_write( graph_diff_t* diff, FILE* out );
+
+/**
+ * @brief   Write the vertex or edge set of the change set as JSON
+ *
+ * @param diff  pointer to the change set
+ * @param set   pointer to the vertex or edge set of the change set
+ * @param out   the stream to write to
+ */
+void smxdiff_write_set( graph_diff_t* diff, diff_set_t* set, FILE* out );
+
+#endif // SMXDIFF_H
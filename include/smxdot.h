@@ -11,9 +11,53 @@
 #ifndef DOT_H
 #define DOT_H
 
+#include <stdbool.h>
 #include <stdio.h>
 #include "ast.h"
 
+#ifdef DOT_CON
+#include "uthash.h"
+
+// TYPEDEFS -------------------------------------------------------------------
+typedef struct dot_block_s dot_block_t;         /**< ::dot_block_s */
+typedef struct dot_bucket_s dot_bucket_t;       /**< ::dot_bucket_s */
+typedef struct dot_bucket_key_s dot_bucket_key_t; /**< ::dot_bucket_key_s */
+
+// STRUCTS --------------------------------------------------------------------
+/**
+ * @brief   A block of dot instructions following a divider
+ *
+ * The block points into the buffer holding the raw dot file.
+ */
+struct dot_block_s
+{
+    const char*     text;   /**< start of the block */
+    size_t          len;    /**< number of bytes of the block */
+    int             idx;    /**< position of the divider in the raw file */
+    dot_block_t*    next;   /**< next block of the same bucket */
+};
+
+/**
+ * @brief   The key of a bucket, i.e. the tag of a divider
+ */
+struct dot_bucket_key_s
+{
+    int     scope;  /**< the scope of the divider */
+    char    flag;   /**< the flag of the divider */
+};
+
+/**
+ * @brief   All blocks with the same divider tag, in order of the raw file
+ */
+struct dot_bucket_s
+{
+    dot_bucket_key_t    key;    /**< the divider tag, hash key */
+    dot_block_t*        first;  /**< first block of the bucket */
+    dot_block_t*        last;   /**< last block of the bucket */
+    UT_hash_handle      hh;     /**< makes this structure hashable */
+};
+#endif // DOT_CON
+
 #ifdef DOT_AST
 /**
  * @brief   Draw a dot diagram of the AST
@@ -95,10 +139,41 @@ void graph_finish_subgraph( FILE* graph );
  * to reorder the file in order to correctly compile. This functions performs
  * this reordering.
  *
- * @param t_path    path to a temporary file
+ * The file is read once into memory and split into lines. The lines
+ * following each divider are collected in buckets by flag and scope. The text
+ * before the first divider is written once, followed by the buckets of each
+ * scope in the order of the flags.
+ *
  * @param r_path    path to the dot file to be reordered
  */
-void graph_fix_dot( char* t_path, char* r_path );
+void graph_fix_dot( char* r_path );
+
+/**
+ * @brief   Get the bucket of a divider tag and create it if it does not exist
+ *
+ * @param buckets   pointer to the bucket hash table
+ * @param flag      the flag of the divider
+ * @param scope     the scope of the divider
+ * @return          pointer to the bucket
+ */
+dot_bucket_t* graph_fix_dot_bucket( dot_bucket_t** buckets, char flag,
+        int scope );
+
+/**
+ * @brief   Write the blocks of a bucket which follow a divider
+ *
+ * @param graph     file pointer to the dot file
+ * @param buckets   the bucket hash table
+ * @param flag      the flag of the divider
+ * @param scope     the scope of the divider
+ * @param idx       only blocks with a higher position are written
+ * @param all       if true all such blocks of the bucket are written, if
+ *                  false only the first one is written
+ * @return          pointer to the last block written or NULL if none was
+ *                  written
+ */
+dot_block_t* graph_fix_dot_write( FILE* graph, dot_bucket_t* buckets,
+        char flag, int scope, int idx, bool all );
 #endif // DOT_CON
 
 /**
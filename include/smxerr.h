@@ -9,20 +9,102 @@
 #ifndef ERROR_H
 #define ERROR_H
 
+#include <stdbool.h>
 #include <stdio.h>
+#ifdef SMXC_THREADS
+#include <pthread.h>
+#endif // SMXC_THREADS
 #include "defines.h"
+#include "uthash.h"
 
 extern char* yytext;
 extern int yylineno;
 extern int yynerrs;
 extern char* __src_file_name;
+#ifdef SMXC_THREADS
+// serialises error reports and global bookkeeping of concurrent flatten jobs
+extern pthread_mutex_t __smxc_lock;
+#endif // SMXC_THREADS
 
 #define CONST_ERROR_LEN 256
 
+typedef struct diag_s diag_t;               /**< ::diag_s */
+
+/**
+ * @brief   A buffered diagnostic message
+ */
+struct diag_s
+{
+    char*           text;       /**< formatted message, hash key */
+    char*           note;       /**< additional text printed after the message
+                                     or NULL */
+    bool            is_printed; /**< true if the message has been flushed */
+    diag_t*         next;       /**< next message in order of report */
+    UT_hash_handle  hh;         /**< makes this structure hashable */
+};
+
 /* handle errors with the bison error function */
 void yyerror ( void**, const char* );
 
-void report_yyerror( const char*, int );
+/**
+ * @brief   Report a diagnostic at a given line
+ *
+ * @param msg   the message, starting with #ERR_ERROR or #ERR_WARNING
+ * @param line  the line number in the source file
+ * @return      true if the message was recorded, false if it is a repetition
+ *              or the error limit has been reached
+ */
+bool report_yyerror( const char*, int );
+
+/**
+ * @brief   Attach a note to the last recorded diagnostic
+ *
+ * @param note  the text to print after the diagnostic
+ */
+void report_note( const char* note );
+
+/**
+ * @brief   Record a formatted diagnostic in the buffer
+ *
+ * Repetitions of a message are dropped. Once the number of errors reaches the
+ * limit set with `--max-errors` all further diagnostics are dropped.
+ *
+ * @param text      the formatted message
+ * @param is_error  true if the message is an error, false for a warning
+ * @return          true if the message was recorded, false otherwise
+ */
+bool smxerr_add( const char* text, bool is_error );
+
+/**
+ * @brief   Format a message with the current file, line, and token and record
+ *          it in the buffer
+ *
+ * @param s     the message, starting with #ERR_ERROR or #ERR_WARNING
+ * @return      true if the message was recorded, false otherwise
+ */
+bool smxerr_add_msg( const char* s );
+
+/**
+ * @brief   Free all buffered diagnostics
+ */
+void smxerr_destroy();
+
+/**
+ * @brief   Print all buffered diagnostics which have not yet been printed
+ *
+ * If diagnostics were dropped due to the error limit, the number of dropped
+ * diagnostics is printed once.
+ */
+void smxerr_flush();
+
+/**
+ * @brief   Check whether an error has been recorded
+ *
+ * Warnings are not considered.
+ *
+ * @return  true if at least one error was recorded, false otherwise
+ */
+bool smxerr_has_errors();
 
 #define ERR_WARNING "warning"
 #define ERR_ERROR   "error"
@@ -72,6 +154,20 @@ void report_yyerror( const char*, int );
 #define ERROR_NONDET\
     "%s: nondeterminism on deterministic operation '%s|%s', use '!' instead"
 
+#define ERROR_BAD_MSG_SIZE\
+    "%s: conflicting message sizes of ports '%s' in '%s'(%d) (%d bytes) and"\
+    " '%s' in '%s'(%d) (%d bytes)"
+
+#define ERROR_BAD_MSG_SIZE_CP\
+    "%s: conflicting message sizes %d and %d of channels at routing node"\
+    " '%s'(%d)"
+
+#define ERROR_FARM_WIDTH\
+    "%s: width of farm exceeds the limit of %d replicas"
+
+#define ERROR_FARM_ALLOC\
+    "%s: cannot allocate the %d replicas of farm"
+
 #define ERROR_NO_PORT_CON_CLASS\
     "%s: unconnected port '%s' in '%s'(%d) of serial combinition '%s.%s'\n"\
     " -> for bypassing, use operator ':' or a wrapper"
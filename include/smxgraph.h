@@ -13,8 +13,19 @@
 
 // TYPEDEFS -------------------------------------------------------------------
 typedef struct sync_s sync_t;   /**< ::sync_s */
+typedef struct sync_name_s sync_name_t;   /**< ::sync_name_s */
+typedef struct flatten_job_s flatten_job_t;     /**< ::flatten_job_s */
+typedef struct flatten_pool_s flatten_pool_t;   /**< ::flatten_pool_s */
 
 #include <igraph.h>
+#ifdef SMXC_THREADS
+#include <pthread.h>
+// the flatten workers read the attributes of a shared graph concurrently
+#if !IGRAPH_THREAD_SAFE
+#error "SMXC_THREADS requires igraph to be built thread-safe (--enable-tls)"
+#endif
+#endif // SMXC_THREADS
+#include "uthash.h"
 #include "vnet.h"
 #include "symtab.h"
 
@@ -28,6 +39,42 @@ struct sync_s
     igraph_vector_ptr_t p_ext;  /**< list of the external port names */
 };
 
+/**
+ * @brief   Hash table entry of an internal wrapper port name
+ */
+struct sync_name_s
+{
+    const char*     name;       /**< the internal port name, hash key */
+    igraph_vector_t syncs;      /**< indices of the syncs holding the name */
+    int             scan;       /**< the last scan which collected the name */
+    UT_hash_handle  hh;         /**< makes this structure hashable */
+};
+
+/**
+ * @brief   The expansion of a net instance during flattening
+ */
+struct flatten_job_s
+{
+    igraph_t    g_child;    /**< the flattened graph of the net instance */
+    igraph_t*   g_in;       /**< the unmodified graph holding the instance */
+    int         inst_id;    /**< the id of the net instance in g_in */
+    bool        is_ready;   /**< true if the child graph was prepared */
+    bool        is_valid;   /**< false if the net has an empty graph */
+};
+
+#ifdef SMXC_THREADS
+/**
+ * @brief   A pool of threads preparing flatten jobs
+ */
+struct flatten_pool_s
+{
+    flatten_job_t*  jobs;       /**< the jobs to prepare */
+    int             job_cnt;    /**< the number of jobs */
+    int             next;       /**< the index of the next free job */
+    pthread_mutex_t lock;       /**< protects the job index */
+};
+#endif // SMXC_THREADS
+
 // FUNCTIONS ------------------------------------------------------------------
 
 /**
@@ -82,6 +129,17 @@ void dgraph_edge_add_attr( igraph_t* g, int id, const char* name,
         int tns_src, int ts_dst, int tns_dst, rate_type_t type,
         bool is_dyn_src, bool is_dyn_dst );
 
+/**
+ * @brief   Update the edge ids stored in the ports of the dependency graph
+ *
+ * Deleting edges from the graph shifts the ids of all remaining edges. This
+ * function makes sure that the ports connected by an edge point to the edge
+ * id currently assigned by the graph.
+ *
+ * @param g pointer to the dependency graph
+ */
+void dgraph_edge_update_ids( igraph_t* g );
+
 /**
  * @brief   destroy the attributes of a graph
  *
@@ -105,6 +163,16 @@ void dgraph_destroy_attr_v( igraph_t* g, const char* attr );
  */
 void dgraph_destroy_attr_e( igraph_t* g, const char* attr );
 
+/**
+ * @brief   Get a new farm id
+ *
+ * Each installation of a farm gets its own id, such that the replicas of an
+ * outer farm hold distinct inner farms.
+ *
+ * @return  the new farm id
+ */
+int dgraph_farm_add();
+
 /**
  * @brief   Flatten a hierarchical graph
  *
@@ -118,6 +186,52 @@ void dgraph_destroy_attr_e( igraph_t* g, const char* attr );
  */
 void dgraph_flatten( igraph_t* g_new, igraph_t* g );
 
+/**
+ * @brief   Prepare the child graph of a net instance
+ *
+ * Create a deep copy of the graph of the net, propagate the instance
+ * attributes to it, and flatten it. This only reads from the graph holding
+ * the instance and can thus be done concurrently for independent instances.
+ *
+ * @param job   pointer to the flatten job of the net instance
+ */
+void dgraph_flatten_child( flatten_job_t* job );
+
+/**
+ * @brief   Flatten all net instances of a graph in place
+ *
+ * The child graphs of all net instances are prepared (concurrently if
+ * requested) and spliced into the graph one after another in the order of
+ * the instances. The resulting vertex and edge ids do not depend on the
+ * number of threads.
+ *
+ * @param g             the graph to be flattened
+ * @param thread_cnt    the number of threads to prepare child graphs with.
+ *                      Nested net instances are flattened on the thread of
+ *                      their parent. Only effective if compiled with
+ *                      SMXC_THREADS.
+ */
+void dgraph_flatten_graph( igraph_t* g, int thread_cnt );
+
+#ifdef SMXC_THREADS
+/**
+ * @brief   Prepare flatten jobs on a pool of threads
+ *
+ * @param jobs          array of flatten jobs
+ * @param job_cnt       number of flatten jobs
+ * @param thread_cnt    maximal number of threads to use
+ */
+void dgraph_flatten_pool( flatten_job_t* jobs, int job_cnt, int thread_cnt );
+
+/**
+ * @brief   Thread function preparing jobs of a pool until none are left
+ *
+ * @param arg   pointer to the ::flatten_pool_s
+ * @return      NULL
+ */
+void* dgraph_flatten_worker( void* arg );
+#endif // SMXC_THREADS
+
 /**
  * @brief   Helper function to flatten the graph
  *
@@ -131,6 +245,18 @@ void dgraph_flatten( igraph_t* g_new, igraph_t* g );
 void dgraph_flatten_net( igraph_t* g_new, igraph_t* g_child,
         virt_net_t* v_net );
 
+/**
+ * @brief   Forget the edges checked by the last merge pass
+ *
+ * The mark #GG_MERGE_ECNT set by post_process_merge_new() is removed, hence
+ * the next merge pass checks all edges of the graph. This is required whenever
+ * edges or vertices are removed because the degree of a routing node may drop
+ * and make an old channel mergeable.
+ *
+ * @param g     pointer to the dependency graph
+ */
+void dgraph_merge_mark_clear( igraph_t* g );
+
 /**
  * @brief   Search an equivalent port in a similar virtual net
  *
@@ -179,6 +305,22 @@ void dgraph_vertex_add_attr( igraph_t* g, int id, const char* func,
         symrec_t* symb, virt_net_t* v_net, igraph_t* g_net, bool attr_static,
         bool attr_pure, location_type_t attr_location );
 
+/**
+ * @brief   Set the instance path of a vertex
+ *
+ * The path of a vertex is its name followed by the line of the instance, e.g.
+ * `a@12`. Routing nodes have no line. The path is prefixed with the paths of
+ * the surrounding nets and wrappers when the graph is flattened (see
+ * dgraph_vertex_propagate_attrs()).
+ *
+ * @param g     graph where the vertex resides
+ * @param id    id of the vertex
+ * @param name  the name of the instance
+ * @param line  the line of the instance or -1
+ */
+void dgraph_vertex_add_attr_path( igraph_t* g, int id, const char* name,
+        int line );
+
 /**
  * @brief   Mark a vertex as time-triggered vertex
  *
@@ -252,6 +394,47 @@ instrec_t* dgraph_vertex_copy( igraph_t* g_src, igraph_t* g_dest, int id,
  */
 void dgraph_vertex_destroy_attr( igraph_t* g, int id, bool deep );
 
+/**
+ * @brief   Get a numeric farm attribute of a vertex
+ *
+ * @param g     pointer to the dependancy graph
+ * @param id    id of the vertex
+ * @param name  name of the attribute, e.g. #GV_FARM or #GV_REPLICA_OUTER
+ * @return      the value of the attribute or 0 if the vertex has none
+ */
+int dgraph_vertex_get_farm( igraph_t* g, int id, const char* name );
+
+/**
+ * @brief   Initialise the farm attributes of a vertex
+ *
+ * Attributes the vertex does not hold yet are set to 0.
+ *
+ * @param g     pointer to the dependancy graph
+ * @param id    id of the vertex
+ */
+void dgraph_vertex_init_farm( igraph_t* g, int id );
+
+/**
+ * @brief   Check whether a vertex is part of a farm
+ *
+ * This is true for the replicas of a farm and for the dispatchers and
+ * collectors of a farm.
+ *
+ * @param g     pointer to the dependancy graph
+ * @param id    id of the vertex
+ * @return      true if the vertex has a valid attribute #GV_FARM
+ */
+bool dgraph_vertex_is_farm( igraph_t* g, int id );
+
+/**
+ * @brief   Check whether a vertex is a dispatcher or a collector of a farm
+ *
+ * @param g     pointer to the dependancy graph
+ * @param id    id of the vertex
+ * @return      true if the attribute #GV_FARM_RN is set
+ */
+bool dgraph_vertex_is_farm_rn( igraph_t* g, int id );
+
 /**
  * @brief   Merge two vertices into one
  *
@@ -265,6 +448,13 @@ int dgraph_vertex_merge( igraph_t* g, int id1, int id2 );
 /**
  * @brief set the attributes static and tt for all vertices in the child graph
  *
+ * The instance path (#GV_PATH) of each vertex is prefixed with the path of the
+ * parent vertex. The farms of the child graph get new ids which are unique in
+ * the flattened graph. If the parent vertex is a replica of a farm, vertices
+ * which are not part of a farm of their own take over its farm and replica and
+ * farms of the child graph record it as their outer farm (#GV_FARM_OUTER and
+ * #GV_REPLICA_OUTER).
+ *
  * @param g_in  pointer to the parent graph object
  * @param g     pointer to the child graph object
  * @param id    id of a vertex in the parent graph
@@ -279,6 +469,18 @@ void dgraph_vertex_propagate_attrs( igraph_t* g_in, igraph_t* g, int id );
  */
 void dgraph_vertex_remove( igraph_t* g, int id );
 
+/**
+ * @brief   Renumber the farms of a graph
+ *
+ * The ids in #GV_FARM and #GV_FARM_OUTER are replaced in the order of the
+ * vertices, the outer farm of a vertex first. The same old id gets the same
+ * new id.
+ *
+ * @param g         pointer to the graph
+ * @param farm_cnt  pointer to the last id given to a farm, is updated
+ */
+void dgraph_vertex_update_farms( igraph_t* g, int* farm_cnt );
+
 /**
  * @brief   decrement the instance id of all vertices in a graph
  *
@@ -318,13 +520,13 @@ void dgraph_wrap_sync_create( igraph_t* g, igraph_vector_ptr_t* syncs,
 int get_ch_len( virt_port_t* p1, virt_port_t* p2 );
 
 /**
- * @brief   check wheather two sync structures can be merged
+ * @brief get the message size of a channel given two port pointers
  *
- * @param v1            pointer to a port list vector
- * @param v2            pointer to a port list vector
- * @return              true if they can be merged, false if not
+ * @param p1    pointer to a virtual port
+ * @param p2    pointer to a virtual port
+ * @return int  the declared message size in bytes or 0 if none is declared
  */
-bool is_wrap_sync_merge_int( igraph_vector_ptr_t* v1, igraph_vector_ptr_t* v2 );
+int get_msg_size( virt_port_t* p1, virt_port_t* p2 );
 
 /**
  * @brief   establish the internal wrapper connections
@@ -355,20 +557,18 @@ void wrap_sync_init( igraph_vector_ptr_t* syncs, symrec_list_t* wrap_ports );
 /**
  * @brief   merge the sync structures
  *
+ * Each sync absorbs the following syncs which share an internal port name
+ * with it, in order. The internal port names of an absorbed sync are added
+ * once per name and its external ports are appended. After a sync absorbed n
+ * others the scan steps back by n syncs, the first sync is not revisited.
+ * Internal port names are hashed together with the syncs holding them and
+ * the candidates of a scan are taken from a heap, such that only syncs
+ * sharing a name are visited.
+ *
  * @param syncs pointer to a vector object containing sync structure pointers
  */
 void wrap_sync_merge( igraph_vector_ptr_t* syncs );
 
-/**
- * @brief   merge ports of two sync structures
- *
- * @param v1            pointer to a port list vector
- * @param v2            pointer to a port list vector
- * @param check_name    if true dont add duplicates
- */
-void wrap_sync_merge_port( igraph_vector_ptr_t* v1, igraph_vector_ptr_t* v2,
-        bool check_name );
-
 /**
  * @brief   print debug information of the sync structures
  *
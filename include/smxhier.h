@@ -0,0 +1,256 @@
+/**
+ * Hierarchical (non-flattened) output of the dependency graph
+ *
+ * @file    smxhier.h
+ * @author  Simon Maurer
+ *
+ */
+
+#ifndef SMXHIER_H
+#define SMXHIER_H
+
+// TYPEDEFS -------------------------------------------------------------------
+typedef struct hier_group_s hier_group_t;   /**< ::hier_group_s */
+typedef struct hier_s hier_t;               /**< ::hier_s */
+typedef struct tpl_s tpl_t;                 /**< ::tpl_s */
+
+#include <stdbool.h>
+#include <igraph.h>
+#include "uthash.h"
+#include "vnet.h"
+
+// STRUCTS --------------------------------------------------------------------
+/**
+ * @brief   Template of a net or wrapper definition
+ *
+ * Each definition is exported exactly once, no matter how often it is
+ * instantiated.
+ */
+struct tpl_s
+{
+    symrec_t*       symb;   /**< pointer to the net symbol, hash key */
+    char*           name;   /**< unique name of the template */
+    igraph_t        g;      /**< exported graph of the definition */
+    UT_hash_handle  hh;     /**< makes this structure hashable */
+};
+
+/**
+ * @brief   Net or wrapper instance collapsed into one vertex of a dot file
+ */
+struct hier_group_s
+{
+    char*           name;   /**< instance path of the net, hash key */
+    int             id;     /**< id of the collapsed vertex */
+    UT_hash_handle  hh;     /**< makes this structure hashable */
+};
+
+/**
+ * @brief   Hierarchical view of a program
+ */
+struct hier_s
+{
+    igraph_t    g;      /**< exported top-level graph */
+    tpl_t*      tpls;   /**< hash table of all referenced templates */
+};
+
+// FUNCTIONS ------------------------------------------------------------------
+
+/**
+ * @brief   Free all graphs and templates of a hierarchical view
+ *
+ * @param hier  pointer to the hierarchical view
+ */
+void smxhier_destroy( hier_t* hier );
+
+/**
+ * @brief   Collapse all channels between the same pair of instances
+ *
+ * The graph is copied and parallel channels are replaced by a single edge
+ * which holds the number of channels in the edge attribute #GE_COUNT and as
+ * label. All other edge attributes are dropped. If the graph is already
+ * collapsed, the counts of its edges are summed up.
+ *
+ * @param g         pointer to the graph to collapse
+ * @param g_out     pointer to an uninitialised graph which will hold the result
+ */
+void smxhier_dot_collapse( igraph_t* g, igraph_t* g_out );
+
+/**
+ * @brief   Expand all net instances of a hierarchical view
+ *
+ * Each net or wrapper instance of the view is replaced by the vertices of its
+ * template, recursively, and its channels are connected to the vertices which
+ * hold the ports of the template according to #GG_PORTS. Each vertex gets the
+ * instance path #GV_PATH of the nets containing it, made of the label and the
+ * vertex id in the view or template of each level, such that the result can
+ * be collapsed with smxhier_dot_reduce(). Only the labels are kept.
+ *
+ * @param hier      pointer to the hierarchical view holding the templates
+ * @param g         pointer to the top-level graph or a template of the view
+ * @param g_out     pointer to an uninitialised graph which will hold the result
+ */
+void smxhier_dot_expand( hier_t* hier, igraph_t* g, igraph_t* g_out );
+
+/**
+ * @brief   Map the vertices of a flattened graph to the nets they belong to
+ *
+ * All vertices which are nested deeper than \p depth levels according to
+ * their instance path #GV_PATH are mapped to the net or wrapper instance of
+ * level \p depth which contains them. All other vertices are mapped to
+ * themselves. The ids of the mapping are consecutive. Instances of the same
+ * net on the same line share their instance path and are mapped together.
+ *
+ * @param g         pointer to the flattened graph
+ * @param depth     the number of levels which are kept
+ * @param mapping   pointer to an initialised vector which will hold the new
+ *                  vertex id of each vertex
+ * @param groups    pointer to an empty hash table which will hold the nets
+ * @return          the number of vertices after the mapping
+ */
+int smxhier_dot_group( igraph_t* g, int depth, igraph_vector_t* mapping,
+        hier_group_t** groups );
+
+/**
+ * @brief   Free the nets of a vertex mapping
+ *
+ * @param groups    pointer to the hash table of the nets
+ */
+void smxhier_dot_group_destroy( hier_group_t** groups );
+
+/**
+ * @brief   Collapse the nets of a flattened graph to fit a vertex budget
+ *
+ * The nets are collapsed level by level, starting with the deepest one, until
+ * the graph fits into the budget or only the top-level remains. Each
+ * collapsed net becomes a single vertex labelled with its instance path and
+ * parallel channels are collapsed with smxhier_dot_collapse().
+ *
+ * @param g             pointer to the flattened graph with instance paths
+ * @param g_out         pointer to an uninitialised graph which will hold the
+ *                      result
+ * @param max_vertices  the vertex budget
+ */
+void smxhier_dot_reduce( igraph_t* g, igraph_t* g_out, int max_vertices );
+
+/**
+ * @brief   Write a graph as dot file within a vertex budget
+ *
+ * If a flattened graph exceeds the budget, its nets are collapsed with
+ * smxhier_dot_reduce() and a note is printed. A graph without instance paths
+ * cannot be collapsed and is written in full. If the written graph still
+ * exceeds the budget a note is printed. The instance paths are not written.
+ *
+ * @param g             pointer to the graph
+ * @param path          path to the dot file
+ * @param max_vertices  the vertex budget or 0 if the graph is not limited
+ * @return              0 on success, -1 if the file cannot be opened
+ */
+int smxhier_dot_write( igraph_t* g, const char* path, int max_vertices );
+
+/**
+ * @brief   Write one collapsed dot file per top-level net or wrapper instance
+ *
+ * Each instance of the hierarchical view is written to
+ * `path/NAME_ID.dot` where NAME is the label and ID the vertex id of the
+ * instance. The file shows the template of the instance written with
+ * smxhier_dot_write_view().
+ *
+ * @param hier          pointer to the hierarchical view
+ * @param path          path to the dot folder
+ * @param max_vertices  the vertex budget of each file
+ * @return              the number of written files
+ */
+int smxhier_dot_write_insts( hier_t* hier, const char* path,
+        int max_vertices );
+
+/**
+ * @brief   Write a graph of the hierarchical view as dot file
+ *
+ * The nested net instances of the graph are expanded with
+ * smxhier_dot_expand() and the parallel channels are collapsed with
+ * smxhier_dot_collapse(). If the result exceeds the budget, the nets are
+ * collapsed with smxhier_dot_reduce() by smxhier_dot_write(), starting with
+ * the deepest ones, until it fits or only the instances of the graph itself
+ * remain.
+ *
+ * @param hier          pointer to the hierarchical view holding the templates
+ * @param g             pointer to the top-level graph or a template of the view
+ * @param path          path to the dot file
+ * @param max_vertices  the vertex budget
+ * @return              0 on success, -1 if the file cannot be opened
+ */
+int smxhier_dot_write_view( hier_t* hier, igraph_t* g, const char* path,
+        int max_vertices );
+
+/**
+ * @brief   Export an unflattened graph and all templates it references
+ *
+ * The graph is copied and each net or wrapper instance vertex gets the name of
+ * its template in the vertex attribute #GV_TEMPLATE. Each channel gets the
+ * names of the ports it binds in the edge attributes #GE_PSRC_NAME and
+ * #GE_PDST_NAME such that an instance can be connected to the interface of
+ * its template. The copy is passed through post_process_decoupling(),
+ * post_process_farm() and post_process_msg_size(), such that its attributes
+ * match those of the flattened graph, but routing nodes are neither merged
+ * across nets nor reduced. All pointer attributes are removed from the copy.
+ * Templates not yet in the hash table are exported recursively.
+ *
+ * @param g         pointer to the unflattened graph
+ * @param g_out     pointer to an uninitialised graph which will hold the copy
+ * @param tpls      pointer to the template hash table
+ */
+void smxhier_export( igraph_t* g, igraph_t* g_out, tpl_t** tpls );
+
+/**
+ * @brief   Create the hierarchical view of the top-level net
+ *
+ * This function must be called before the top-level net is flattened and
+ * destroyed.
+ *
+ * @param g     pointer to the unflattened top-level graph
+ * @param hier  pointer to the hierarchical view to initialise
+ */
+void smxhier_init( igraph_t* g, hier_t* hier );
+
+/**
+ * @brief   Get the template of a net or wrapper symbol
+ *
+ * If the symbol has no template yet, a template with a unique name is created
+ * and the graph of the definition is exported with smxhier_export(). The
+ * interface of the definition is stored in the graph attribute #GG_PORTS.
+ *
+ * @param tpls  pointer to the template hash table
+ * @param symb  pointer to the net or wrapper symbol
+ * @param g     pointer to the graph of the definition
+ * @return      pointer to the template
+ */
+tpl_t* smxhier_tpl_get( tpl_t** tpls, symrec_t* symb, igraph_t* g );
+
+/**
+ * @brief   Store the interface of a definition as a graph attribute
+ *
+ * Each open port is written as `mode name vid` where mode is one of `in`,
+ * `out`, or `bi` and vid is the id of the vertex inside the template which
+ * provides the port. Ports are separated by `;`.
+ *
+ * @param g     pointer to the exported graph of the template
+ * @param v_net pointer to the virtual net describing the interface
+ */
+void smxhier_tpl_ports( igraph_t* g, virt_net_t* v_net );
+
+/**
+ * @brief   Write all templates to separate files
+ *
+ * Each template is written to `path/NAME.FORMAT`.
+ *
+ * @param hier      pointer to the hierarchical view
+ * @param path      path to the template folder
+ * @param format    either #G_FMT_GML or #G_FMT_GRAPHML
+ * @param compress  if true, the files are deflated while they are written and
+ *                  get the suffix #SMXZ_SUFFIX
+ * @return          the number of written templates
+ */
+int smxhier_write_tpls( hier_t* hier, const char* path, const char* format,
+        bool compress );
+
+#endif // SMXHIER_H
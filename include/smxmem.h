@@ -0,0 +1,138 @@
+/**
+ * Precomputed memory layout of all channel buffers
+ *
+ * @file    smxmem.h
+ * @author  Simon Maurer
+ *
+ */
+
+#ifndef SMXMEM_H
+#define SMXMEM_H
+
+// TYPEDEFS -------------------------------------------------------------------
+typedef struct msg_size_s msg_size_t;       /**< ::msg_size_s */
+typedef struct mem_layout_s mem_layout_t;   /**< ::mem_layout_s */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <igraph.h>
+#include "uthash.h"
+
+// STRUCTS --------------------------------------------------------------------
+/**
+ * @brief   Declared message size of a channel
+ */
+struct msg_size_s
+{
+    char*           name;   /**< channel name, hash key */
+    uint64_t        size;   /**< size of one message in bytes */
+    UT_hash_handle  hh;     /**< makes this structure hashable */
+};
+
+/**
+ * @brief   Summary of the channel memory layout
+ */
+struct mem_layout_s
+{
+    uint64_t    size;           /**< number of used bytes of the arena */
+    uint64_t    arena;          /**< size of the arena in bytes */
+    int         ch_cnt;         /**< number of placed channels */
+    int         missing_cnt;    /**< number of channels with the default
+                                     message size */
+};
+
+// FUNCTIONS ------------------------------------------------------------------
+
+/**
+ * @brief   Round a size up to the next multiple of an alignment
+ *
+ * @param size  the size to align
+ * @param align the alignment, must be a power of two
+ * @return      the aligned size
+ */
+uint64_t smxmem_align( uint64_t size, uint64_t align );
+
+/**
+ * @brief   Compute the memory footprint of all channels with a message size
+ *
+ * The footprint is the sum of #GE_LEN times #GE_MSG_SIZE over all channels
+ * where a message size was declared on the ports. Padding and indices are not
+ * included, see smxmem_layout() for the actual placement.
+ *
+ * @param g     pointer to the flattened graph
+ * @param bytes pointer to a variable which will hold the footprint in bytes
+ * @return      the number of channels with a declared message size
+ */
+int smxmem_footprint( igraph_t* g, uint64_t* bytes );
+
+/**
+ * @brief   Print the memory footprint of the channels
+ *
+ * @param ch_cnt    the number of channels with a declared message size
+ * @param bytes     the footprint in bytes
+ */
+void smxmem_footprint_print( int ch_cnt, uint64_t bytes );
+
+/**
+ * @brief   Compute the memory layout of all channel buffers
+ *
+ * All channels are packed into one arena in the order of their edge ids.
+ * Each channel starts at a cache line and gets a cache line for the write
+ * index of the producer (#GE_MEM_WR), a cache line for the read index of the
+ * consumer (#GE_MEM_RD), and a buffer (#GE_MEM_BUF) of #GE_LEN slots of the
+ * message size (#GE_MSG_SIZE) rounded up to #SMXMEM_ALIGN. The buffer is
+ * padded to a cache line such that no two indices or buffers share a cache
+ * line. The offsets are stored as edge attributes and the size of the arena,
+ * rounded up to a huge page, in the graph attribute #GG_MEM_ARENA.
+ *
+ * @param g         pointer to the flattened graph
+ * @param sizes     hash table of declared message sizes, may be NULL
+ * @param layout    pointer to the summary to fill in
+ */
+void smxmem_layout( igraph_t* g, msg_size_t* sizes, mem_layout_t* layout );
+
+/**
+ * @brief   Print a summary of the channel memory layout
+ *
+ * @param layout    pointer to the summary
+ */
+void smxmem_layout_print( mem_layout_t* layout );
+
+/**
+ * @brief   Free the hash table of message sizes
+ *
+ * @param sizes pointer to the hash table
+ */
+void smxmem_msg_size_destroy( msg_size_t** sizes );
+
+/**
+ * @brief   Get the message size of a channel
+ *
+ * The channel is looked up as `BOX.PORT`, where BOX is the label of the
+ * producer and PORT the label of the channel, then as `PORT`. Otherwise the
+ * message size declared on the ports (#GE_MSG_SIZE) is used and finally the
+ * entry `*`. If none is declared #SMXMEM_MSG_SIZE is used.
+ *
+ * @param g     pointer to the flattened graph
+ * @param sizes hash table of declared message sizes, may be NULL
+ * @param eid   the id of the channel
+ * @param size  pointer to a variable which will hold the message size
+ * @return      true if the size was declared, false otherwise
+ */
+bool smxmem_msg_size_get( igraph_t* g, msg_size_t* sizes, int eid,
+        uint64_t* size );
+
+/**
+ * @brief   Read the message sizes of channels from a file
+ *
+ * Each line holds a channel name (see smxmem_msg_size_get()) followed by the
+ * size of one message in bytes with an optional unit suffix `k` or `M`.
+ * Lines starting with `#` are ignored.
+ *
+ * @param path  path to the message size file
+ * @param sizes pointer to the hash table to fill in
+ * @return      0 on success, -1 on failure
+ */
+int smxmem_msg_size_read( const char* path, msg_size_t** sizes );
+
+#endif // SMXMEM_H
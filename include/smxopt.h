@@ -0,0 +1,199 @@
+/**
+ * Optimisation passes on the flattened dependency graph
+ *
+ * @file    smxopt.h
+ * @author  Simon Maurer
+ *
+ */
+
+#ifndef SMXOPT_H
+#define SMXOPT_H
+
+// TYPEDEFS -------------------------------------------------------------------
+typedef struct renum_edge_s renum_edge_t;   /**< ::renum_edge_s */
+
+#include <stdbool.h>
+#include <igraph.h>
+#include "vnet.h"
+
+// STRUCTS --------------------------------------------------------------------
+/**
+ * @brief   Sort key of a channel when renumbering the graph
+ */
+struct renum_edge_s
+{
+    int id_src;     /**< vertex id of the producer */
+    int id_dst;     /**< vertex id of the consumer */
+    int eid;        /**< current id of the channel */
+};
+
+// FUNCTIONS ------------------------------------------------------------------
+
+/**
+ * @brief   Contract groups of vertices into their root vertex
+ *
+ * All vertices which have a parent and a valid root are merged into their
+ * root. The vertex attributes of the root are preserved, hence the caller has
+ * to make sure that the pointer attributes of all absorbed vertices already
+ * point to the structures of the root. The channels internal to a group are
+ * deleted and the edge ids stored in the ports are updated.
+ *
+ * @param g         pointer to the dependency graph
+ * @param parent    array holding the parent vertex id of each vertex or -1
+ * @param root      array holding the root vertex id of each vertex or -1
+ * @param dids      pointer to a vector holding the ids of the internal edges
+ * @param v_new     pointer to an initialised vector. It will hold the mapping
+ *                  from old to new vertex ids
+ */
+void smxopt_contract( igraph_t* g, int* parent, int* root,
+        igraph_vector_t* dids, igraph_vector_t* v_new );
+
+/**
+ * @brief   Fuse linear chains of pure boxes into single boxes
+ *
+ * Two pure boxes are linked if the channel between them is the only output
+ * channel of the source box and the only input channel of the destination box
+ * and if the channel is neither decoupled, nor time-triggered, nor dynamic.
+ * Each maximal chain of linked boxes is replaced by one vertex. The
+ * implementation attribute of this vertex lists the implementations of all
+ * stages in order, separated by #TEXT_IMPL_SEP. The channels internal to the
+ * chain are removed together with their ports.
+ *
+ * This function must be called on the flattened graph after post_process().
+ *
+ * @param g pointer to the dependency graph
+ * @return  the number of eliminated boxes
+ */
+int smxopt_fuse_pure( igraph_t* g );
+
+/**
+ * @brief   Check whether two box vertices may be linked in a pure chain
+ *
+ * @param g         pointer to the dependency graph
+ * @param id_src    vertex id of the source box
+ * @param id_dst    vertex id of the destination box
+ * @return          true if both boxes are pure, local, and share the same
+ *                  static and time-triggered attributes, false otherwise
+ */
+bool smxopt_fuse_pure_is_link_ok( igraph_t* g, int id_src, int id_dst );
+
+/**
+ * @brief   Fuse groups of routing nodes into single multicast routing nodes
+ *
+ * Routing nodes connected by fusable channels form a group. post_process()
+ * already merges every routing node which is the only consumer or the only
+ * producer of a channel between two routing nodes, hence the remaining groups
+ * are made of routing nodes with several outputs feeding routing nodes with
+ * several inputs, e.g. diamonds or parallel channels. If such a group is
+ * acyclic and fed by exactly one channel (a single producer), it is collapsed
+ * into the routing node fed by this channel. The root then writes directly to
+ * all channels leaving the group and the channels internal to the group are
+ * removed. Note that before the fusion a message travelling along
+ * reconvergent paths reached a channel leaving the group several times, after
+ * the fusion each message is delivered exactly once to every channel leaving
+ * the group.
+ *
+ * Internal channels that are decoupled, time-triggered, or connected to
+ * dynamic ports are not fused because removing them would change the
+ * semantics of the path. The dispatchers and collectors of farms are not part
+ * of any group.
+ *
+ * This function must be called on the flattened graph after post_process().
+ *
+ * @param g pointer to the dependency graph
+ * @return  the number of eliminated routing nodes
+ */
+int smxopt_fuse_rn( igraph_t* g );
+
+/**
+ * @brief   Get the root of the group a vertex belongs to
+ *
+ * Follows the parent relation until a root is found. The result is memorised
+ * for all vertices along the path.
+ *
+ * @param parent    array holding the parent vertex id of each vertex or -1 if
+ *                  the vertex has no parent
+ * @param root      array holding the root of each vertex. A value of -2 marks
+ *                  an unknown root, a value of -1 marks a vertex which is part
+ *                  of (or depends on) a cycle
+ * @param path      helper array with the size of the vertex count
+ * @param vid       the id of the vertex to get the root from
+ * @return          the id of the root vertex or -1 if the vertex is part of a
+ *                  cycle
+ */
+int smxopt_fuse_root( int* parent, int* root, int* path, int vid );
+
+/**
+ * @brief   Check whether a channel can be removed by fusing its end points
+ *
+ * @param g     pointer to the dependency graph
+ * @param eid   id of the channel
+ * @return      true if the channel is neither decoupled, nor time-triggered,
+ *              nor connected to a dynamic port, false otherwise
+ */
+bool smxopt_is_edge_fusable( igraph_t* g, int eid );
+
+/**
+ * @brief   Renumber boxes and channels such that neighbours are contiguous
+ *
+ * The vertices are visited in Cuthill-McKee order: each connected component
+ * is traversed breadth-first, starting at the source with the lowest id (or
+ * the vertex with the lowest id if the component has no source), and the
+ * unvisited neighbours of a vertex are enqueued by increasing degree. The
+ * order is not reversed such that producers keep lower ids than their
+ * consumers. The channels are then sorted by the new ids of their producer
+ * and consumer such that the channels of a box are contiguous.
+ *
+ * The previous id of each vertex and each channel is stored in the attribute
+ * #GV_ORIG_ID and #GE_ORIG_ID, respectively. The ids stored in the instances
+ * and ports are updated.
+ *
+ * This function must be called on the flattened graph after post_process().
+ *
+ * @param g pointer to the dependency graph
+ * @return  the number of vertices with a new id
+ */
+int smxopt_renumber( igraph_t* g );
+
+/**
+ * @brief   Compare two channels by producer, consumer, and id
+ *
+ * @param a     pointer to the first ::renum_edge_s
+ * @param b     pointer to the second ::renum_edge_s
+ * @return      a negative value, zero, or a positive value if a is sorted
+ *              before, equal to, or after b
+ */
+int smxopt_renumber_cmp( const void* a, const void* b );
+
+/**
+ * @brief   Reorder the channels of the graph
+ *
+ * The channels are added anew in the given order, all edge attributes are
+ * copied, and the old channels are deleted.
+ *
+ * @param g     pointer to the dependency graph
+ * @param order array holding the current channel id of each new channel id
+ */
+void smxopt_renumber_edges( igraph_t* g, int* order );
+
+/**
+ * @brief   Compute the Cuthill-McKee order of the vertices
+ *
+ * @param g     pointer to the dependency graph
+ * @param order array of size vcount which will hold the current vertex id of
+ *              each new vertex id
+ */
+void smxopt_renumber_order( igraph_t* g, int* order );
+
+/**
+ * @brief   Sum of the id distances between the end points of all channels
+ *
+ * This is a measure of how far apart connected boxes are stored in the box
+ * tables of the runtime.
+ *
+ * @param g pointer to the dependency graph
+ * @return  the sum of |src - dst| over all channels
+ */
+long smxopt_span( igraph_t* g );
+
+#endif // SMXOPT_H
@@ -0,0 +1,149 @@
+/**
+ * Streaming deflate compression of graph files
+ *
+ * @file    smxz.h
+ * @author  Simon Maurer
+ *
+ */
+
+#ifndef SMXZ_H
+#define SMXZ_H
+
+#include <stdio.h>
+#include <sys/types.h>
+#include <igraph.h>
+
+// suffix of compressed output files
+#define SMXZ_SUFFIX ".gz"
+// size of the buffer used to deflate and inflate data in memory
+#define SMXZ_CHUNK  16384
+
+// single file archive of all SIAs
+#define SIA_ARCHIVE_NAME    "sia.smxa"
+#define SIA_ARCHIVE_MAGIC   "SMXSIA"
+#define SIA_ARCHIVE_VERSION 2
+#define SIA_ARCHIVE_NUM_LEN 20
+#define SIA_ARCHIVE_RAW     "raw"
+#define SIA_ARCHIVE_GZ      "gz"
+
+// FUNCTIONS ------------------------------------------------------------------
+
+/**
+ * @brief   Close callback of a compressed stream
+ *
+ * @param cookie    the gzip file handler
+ * @return          0 on success, EOF on failure
+ */
+int smxz_close( void* cookie );
+
+/**
+ * @brief   Deflate a buffer and append it as a gzip member to a stream
+ *
+ * @param out   the stream to write to
+ * @param buf   the data to deflate
+ * @param len   the number of bytes in the buffer
+ * @return      the number of written bytes or -1 on failure
+ */
+long smxz_deflate( FILE* out, const char* buf, size_t len );
+
+/**
+ * @brief   Open a compressed file as a standard stream
+ *
+ * The returned stream deflates all data as it is written (or inflates it as it
+ * is read) such that it can be passed directly to the igraph read and write
+ * functions. Reading also accepts uncompressed files. Close the stream with
+ * fclose().
+ *
+ * @param path  path to the file
+ * @param mode  either "r" or "w"
+ * @return      the stream or NULL if the file cannot be opened
+ */
+FILE* smxz_fopen( const char* path, const char* mode );
+
+/**
+ * @brief   Get the graph format of a file from its extension
+ *
+ * The suffix #SMXZ_SUFFIX of a compressed file is ignored.
+ *
+ * @param path  path to the graph file
+ * @return      #G_FMT_GML, #G_FMT_GRAPHML, or NULL if the extension is
+ *              unknown
+ */
+const char* smxz_format( const char* path );
+
+/**
+ * @brief   Inflate a gzip member held in memory
+ *
+ * @param buf       the gzip member
+ * @param len       the number of bytes of the member
+ * @param out_len   pointer to a variable which will hold the size of the
+ *                  inflated data
+ * @return          the inflated data which must be freed or NULL on failure
+ */
+char* smxz_inflate( const char* buf, size_t len, size_t* out_len );
+
+/**
+ * @brief   Read callback of a compressed stream
+ *
+ * @param cookie    the gzip file handler
+ * @param buf       buffer to store the inflated data
+ * @param size      size of the buffer
+ * @return          number of bytes read, 0 on EOF, or -1 on failure
+ */
+ssize_t smxz_read( void* cookie, char* buf, size_t size );
+
+/**
+ * @brief   Read a single SIA from an archive
+ *
+ * The archive starts with the header line
+ * `SMXSIA <version> <count> <format> <raw|gz> <entry_len>` followed by the
+ * table of contents with one entry `<offset> <size> <smx_name>` per SIA. The
+ * entries are sorted by name and padded with spaces to `entry_len` bytes
+ * (including the newline) such that the table is searched by bisection. Offset
+ * and size are zero padded to #SIA_ARCHIVE_NUM_LEN digits and refer to the
+ * byte position of the graph in the archive. If the archive is compressed
+ * each graph is a separate gzip member. Only the entries visited by the search
+ * and the graph itself are read.
+ *
+ * @param g         pointer to an uninitialised graph which will hold the SIA
+ * @param path      path to the archive
+ * @param name      the streamix name of the SIA
+ * @return          0 on success, -1 if the archive cannot be read or does not
+ *                  contain the SIA
+ */
+int smxz_read_archive( igraph_t* g, const char* path, const char* name );
+
+/**
+ * @brief   Read a (compressed) graph file
+ *
+ * This is the counterpart of the compressed output of the compiler and is
+ * meant to be used by the runtime loader.
+ *
+ * @param g         pointer to an uninitialised graph
+ * @param path      path to the graph file
+ * @param format    either #G_FMT_GML or #G_FMT_GRAPHML
+ * @return          0 on success, -1 on failure
+ */
+int smxz_read_graph( igraph_t* g, const char* path, const char* format );
+
+/**
+ * @brief   Write callback of a compressed stream
+ *
+ * @param cookie    the gzip file handler
+ * @param buf       buffer holding the data to deflate
+ * @param size      number of bytes in the buffer
+ * @return          number of bytes written or 0 on failure
+ */
+ssize_t smxz_write( void* cookie, const char* buf, size_t size );
+
+/**
+ * @brief   Write a graph to a compressed file
+ *
+ * @param g         pointer to the graph
+ * @param path      path to the graph file
+ * @param format    either #G_FMT_GML or #G_FMT_GRAPHML
+ * @return          0 on success, -1 on failure
+ */
+int smxz_write_graph( igraph_t* g, const char* path, const char* format );
+
+#endif // SMXZ_H
@@ -20,6 +20,7 @@ typedef enum virt_port_state_e virt_port_state_t;   /**< ::virt_port_state_e */
 typedef enum rate_type_e rate_type_t;               /**< ::rate_type_e */
 
 #include <igraph.h>
+#include <stdio.h>
 #include <time.h>
 #include "symtab.h"
 #include "insttab.h"
@@ -73,6 +74,10 @@ struct virt_net_s
     instrec_t*          inst;       /**< pointer to net instance */
     net_con_t*          con;        /**< connection vector structure */
     virt_port_list_t*   ports;      /**< port list */
+    virt_port_list_t*   ports_closed;   /**< connected and disabled ports
+                                             removed from the port list */
+    virt_port_list_t*   ports_closed_last;  /**< last element of the list of
+                                                 closed ports */
     virt_net_type_t     type;       /**< #virt_net_type_e */
 };
 
@@ -104,6 +109,7 @@ struct virt_port_s
         rate_type_t     type;       /**< ::rate_type_e */
     } rate;
     int                 ch_len;     /**< length of the channel */
+    int                 msg_size;   /**< size of a message or 0 if unknown */
     bool                descoupled; /**< is port decoupled? */
     bool                is_open;    /**< is port open? */
     bool                is_dynamic; /**< is port dynamic? */
@@ -204,7 +210,8 @@ virt_net_t* virt_net_create_net( virt_net_t* v_net_n, instrec_t* inst );
  * @brief   Create a virtual net from two operands op1|op2
  *
  * Create a new virtial net from two parallel nets, following the
- * parallel connection semantics of Streamix
+ * parallel connection semantics of Streamix. The port lists of the operands
+ * are moved to the new net (see virt_port_move()).
  *
  * @param v_net1    pointer to virtual net of left operand
  * @param v_net2    pointer to virtual net of right operand
@@ -216,7 +223,8 @@ virt_net_t* virt_net_create_parallel( virt_net_t* v_net1, virt_net_t* v_net2 );
  * @brief   Create a virtual net from two operands op1.op2
  *
  * Create a new virtial net from two serial nets, following the
- * serial connection semantics of Streamix
+ * serial connection semantics of Streamix. The port lists of the operands
+ * are moved to the new net (see virt_port_move()).
  *
  * @param v_net1    pointer to virtual net of left operand
  * @param v_net2    pointer to virtual net of right operand
@@ -367,12 +375,13 @@ virt_port_list_t* virt_port_assign( virt_port_list_t* old,
  * @param open          is port open
  * @param open          is port dynamic
  * @param ch_len        channel length
+ * @param msg_size      message size in bytes or 0 if unknown
  * @return              a pointer to the newly created port
  */
 virt_port_t* virt_port_create( port_class_t port_class, port_mode_t port_mode,
         virt_net_t* vnet, const char* name, symrec_t* symb,
         struct timespec time, rate_type_t rt, bool decoupled, bool is_open,
-        bool is_dynamic, int ch_len );
+        bool is_dynamic, int ch_len, int msg_size );
 
 /**
  * @brief   Create a copy of a virtual port
@@ -409,6 +418,17 @@ virt_port_list_t* virt_ports_copy_symb( symrec_list_t* ports, virt_net_t* v_net,
 virt_port_list_t* virt_ports_copy_vnet( virt_port_list_t* ports,
         virt_net_t* inst, bool check_status, bool copy_status );
 
+/**
+ * @brief   Get the first element of the port list including the closed ports
+ *
+ * Use with virt_port_next_all() to iterate over the port list followed by the
+ * list of closed ports (see virt_port_move()).
+ *
+ * @param v_net pointer to the virtual net
+ * @return      pointer to the first element or NULL if the net has no ports
+ */
+virt_port_list_t* virt_port_first_all( virt_net_t* v_net );
+
 /**
  * @brief   Get an equivalent port from a virtual net
  *
@@ -442,6 +462,46 @@ virt_port_t* virt_port_get_equivalent_by_symb_attr( virt_net_t* v_net,
 virt_port_t* virt_port_get_equivalent_in_wrap( virt_net_t* v_net,
         virt_port_t* port );
 
+/**
+ * @brief   Move the port lists of a virtual net to another virtual net
+ *
+ * The open ports of the source are relinked in reverse order in front of
+ * `list_last` and renumbered, exactly as virt_port_assign() would do with
+ * copies, but no list element is allocated or freed. Connected and disabled
+ * ports are moved to the list of closed ports of the destination instead,
+ * such that repeated compositions only walk the open ports. The list of closed
+ * ports of the source is chained to the list of the destination in constant
+ * time. The port lists of the source are set to NULL, hence the source net can
+ * be destroyed afterwards without affecting the new lists.
+ *
+ * @param v_net     pointer to the destination net, its closed ports are
+ *                  extended
+ * @param v_net_src pointer to the source net
+ * @param list_last a pointer to a list which will be chained to the new list
+ * @return          a pointer to the new port list
+ */
+virt_port_list_t* virt_port_move( virt_net_t* v_net, virt_net_t* v_net_src,
+        virt_port_list_t* list_last );
+
+/**
+ * @brief   Get the next element of the port list including the closed ports
+ *
+ * @param v_net pointer to the virtual net
+ * @param ports pointer to the current element
+ * @return      pointer to the next element or NULL at the end of the list of
+ *              closed ports
+ */
+virt_port_list_t* virt_port_next_all( virt_net_t* v_net,
+        virt_port_list_t* ports );
+
+/**
+ * @brief   Remove a port from the port list of a virtual net and free it
+ *
+ * @param v_net pointer to the virtual net holding the port
+ * @param port  pointer to the port to remove
+ */
+void virt_port_remove( virt_net_t* v_net, virt_port_t* port );
+
 /**
  * @brief   update the instance of a port
  *
@@ -450,6 +510,24 @@ virt_port_t* virt_port_get_equivalent_in_wrap( virt_net_t* v_net,
  */
 void virt_port_update_inst( virt_port_t* port, virt_net_t* v_net );
 
+/**
+ * @brief   Write debug information of a port of a virtual net to a stream
+ *
+ * @param out   file handler to write to
+ * @param port  pointer to the port of a virtual net
+ */
+void debug_fprint_vport( FILE* out, virt_port_t* port );
+
+/**
+ * @brief   Write debug information of all ports in a virtual net to a stream
+ *
+ * @param out   file handler to write to
+ * @param v_net pointer to the virtual net
+ * @param all   flag to indicate whether all ports or only the open ports
+ *              should be written
+ */
+void debug_fprint_vports_s( FILE* out, virt_net_t* v_net, bool all );
+
 /**
  * @brief   Print debug information of a port of a virtual net
  *
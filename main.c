@@ -6,6 +6,13 @@
 #include "context.h"
 #include "smxerr.h"
 #include "smxgraph.h"
+#include "smxopt.h"
+#include "smxana.h"
+#include "smxmem.h"
+#include "smxdiff.h"
+#include "smxcgen.h"
+#include "smxhier.h"
+#include "smxz.h"
 #include "sia.h"
 #include "smx2sia.h"
 #ifdef DOT_AST
@@ -25,7 +32,31 @@ extern int zzlex_destroy();
 #endif
 
 
+/**
+ * @brief   values of long options without a short option equivalent
+ */
+enum long_option_e
+{
+    OPT_FUSE_RN = 256,
+    OPT_FUSE_PURE,
+    OPT_LATENCY_REPORT,
+    OPT_WCET,
+    OPT_TT_SCHEDULE,
+    OPT_PRIO_INHERIT,
+    OPT_PRIO_DECAY,
+    OPT_MAX_ERRORS,
+    OPT_DOT_VIEW,
+    OPT_DOT_MAX_VERTICES,
+    OPT_MEM_LAYOUT,
+    OPT_MSG_SIZE,
+    OPT_RENUMBER,
+    OPT_INST_PATH,
+    OPT_DIFF_AGAINST
+};
+
 int __smxc_min_ch_len = 1;
+int __smxc_jobs = 1;
+int __smxc_max_errors = 0;
 int __smxc_time_criticality_prio[TIME_CTITICALITY_COUNT] = { 1, 1, 2, 3 };
 
 int get_path_size( const char* str )
@@ -49,6 +80,12 @@ void print_usage( const char* name )
     printf( "  -h, --help                  display this help text and exit\n" );
     printf( "  -V, --version               display version information and"
             " exit\n" );
+    printf( "  -j, --jobs=N                flatten the net instances of the"
+            " top-level net\n" );
+    printf( "                              with N threads\n" );
+    printf( "      --max-errors=N          stop reporting diagnostics after N"
+            " errors (0 for\n" );
+    printf( "                              no limit)\n" );
     printf( "\nChannels:\n" );
     printf( "  -l, --channel-len=LENGTH    set the default channel length\n" );
     printf( "\nReal-time Priorities:\n" );
@@ -60,19 +97,88 @@ void print_usage( const char* name )
             " isolated rt nets\n" );
     printf( "      --rt-prio-network=PRIO  set the rt-thread priority of"
             " networked rt nets\n" );
+    printf( "      --prio-inherit          propagate the priorities of tt and"
+            " rt nets to\n" );
+    printf( "                              all upstream boxes and routing"
+            " nodes\n" );
+    printf( "      --prio-decay=DECAY      set the priority loss per channel of"
+            " inherited\n" );
+    printf( "                              priorities (default 1)\n" );
+    printf( "\nOptimisations:\n" );
+    printf( "      --fuse-rn               fuse groups of routing nodes with"
+            " a single\n" );
+    printf( "                              producer into single multicast"
+            " routing nodes\n" );
+    printf( "      --fuse-pure             fuse linear chains of pure boxes"
+            " into single\n" );
+    printf( "                              boxes\n" );
+    printf( "      --renumber              renumber boxes and channels such"
+            " that connected\n" );
+    printf( "                              boxes and their channels are"
+            " contiguous\n" );
+    printf( "\nAnalysis:\n" );
+    printf( "      --latency-report        print the worst-case latencies and"
+            " the critical\n" );
+    printf( "                              path and write them to"
+            " FILE_latency.json\n" );
+    printf( "      --wcet=FILE             set the path to the file with"
+            " worst-case\n" );
+    printf( "                              execution times of boxes\n" );
+    printf( "      --tt-schedule           write the static cyclic schedules of"
+            " tt nets\n" );
+    printf( "                              to FILE_schedule.json\n" );
     printf( "\nOutput Control:\n" );
     printf( "  -s, --sia-path=PATH         set the path to the input file with"
             " SIA\n" );
     printf( "                              descriptions\n" );
     printf( "  -S, --skip-sia              skip the SIA generation\n" );
+    printf( "  -a, --sia-archive           write all SIAs to the single indexed"
+            " file\n" );
+    printf( "                              '%s' in the build path\n",
+            SIA_ARCHIVE_NAME );
     printf( "  -p, --build-path=PATH       set the build path to folder where"
             " the output\n" );
     printf( "                              files will be stored\n" );
     printf( "  -o, --graph-name=FILE       set the filename of the SMX graph"
             " output file\n" );
     printf( "  -f, --graph-format=FROMAT   set the format of the graph to"
-            " either 'gml' or\n" );
-    printf( "                              'graphml'\n" );
+            " either 'gml',\n" );
+    printf( "                              'graphml', or 'c' (C tables of all"
+            " boxes and\n" );
+    printf( "                              channels)\n" );
+    printf( "  -z, --compress              deflate the graph and SIA files"
+            " while writing\n" );
+    printf( "                              them (adds the suffix '.gz')\n" );
+    printf( "  -H, --hierarchical          write the unflattened top-level"
+            " net and each net\n" );
+    printf( "                              definition once to the folder"
+            " 'tpl' in the\n" );
+    printf( "                              build path\n" );
+    printf( "      --dot-view=VIEW         write the dot files of either each"
+            " top-level net\n" );
+    printf( "                              instance ('inst') or the top-level"
+            " net with\n" );
+    printf( "                              collapsed channels ('collapsed') to"
+            " the folder\n" );
+    printf( "                              'dot'\n" );
+    printf( "      --dot-max-vertices=N    limit the number of vertices of each"
+            " dot file by\n" );
+    printf( "                              collapsing nested nets (default"
+            " %d)\n", DOT_MAX_VERTICES );
+    printf( "      --inst-path             store the instance path of each"
+            " vertex (nesting\n" );
+    printf( "                              of nets and wrappers and line) in"
+            " the vertex\n" );
+    printf( "                              attribute 'path'\n" );
+    printf( "      --diff-against=GRAPH    match the flattened graph against"
+            " the file GRAPH\n" );
+    printf( "                              compiled with '--inst-path' and"
+            " write the\n" );
+    printf( "                              added, removed, and modified"
+            " vertices and\n" );
+    printf( "                              channels to FILE_diff.json"
+            " (implies\n" );
+    printf( "                              '--inst-path')\n" );
 }
 
 int main( int argc, char **argv )
@@ -85,9 +191,11 @@ int main( int argc, char **argv )
     char* out_file_path = NULL;
     const char* out_file_name = NULL;
     const char* format = NULL;
+    const char* graph_format = NULL;
     const char* sia_desc_file = NULL;
     const char* build_path = NULL;
     char* build_path_sia = NULL;
+    char* build_path_tpl = NULL;
     int name_size;
     int path_size;
     char* file_name;
@@ -95,6 +203,47 @@ int main( int argc, char **argv )
     FILE* src_sia;
     FILE* out_file;
     bool skip_sia = false;
+    bool sia_archive = false;
+    int sia_cnt;
+    bool fuse_rn = false;
+    bool fuse_pure = false;
+    bool latency_report = false;
+    const char* wcet_file = NULL;
+    wcet_t* wcets = NULL;
+    latency_t lat;
+    char* report_path = NULL;
+    FILE* report_file;
+    bool tt_schedule = false;
+    char* sched_path = NULL;
+    int sched_cnt;
+    bool prio_inherit = false;
+    int prio_decay = 1;
+    int* prio_from;
+    int prio_cnt;
+    int fuse_cnt;
+    bool renumber = false;
+    long span;
+    bool hierarchical = false;
+    const char* opt_flat = NULL;
+    bool compress = false;
+    const char* dot_view = NULL;
+    int dot_max_vertices = DOT_MAX_VERTICES;
+    bool dot_max_given = false;
+    bool mem_layout = false;
+    const char* msg_size_file = NULL;
+    msg_size_t* msg_sizes = NULL;
+    mem_layout_t layout;
+    uint64_t footprint;
+    int footprint_cnt;
+    bool inst_path = false;
+    bool is_valid;
+    const char* diff_file = NULL;
+    char* diff_path = NULL;
+    igraph_t g_old;
+    graph_diff_t diff;
+    int dot_cnt;
+    hier_t hier;
+    int tpl_cnt;
     igraph_i_set_attribute_table( &igraph_cattribute_table );
     igraph_t g;
     int c;
@@ -108,18 +257,37 @@ int main( int argc, char **argv )
         { "help",            no_argument,       0, 'h' },
         { "version",         no_argument,       0, 'V' },
         { "channel-len",     required_argument, 0, 'l' },
+        { "jobs",            required_argument, 0, 'j' },
         { "sia-path",        required_argument, 0, 's' },
         { "skip-sia",        required_argument, 0, 'S' },
+        { "sia-archive",     no_argument,       0, 'a' },
         { "build-path",      required_argument, 0, 'p' },
         { "graph-name",      required_argument, 0, 'o' },
         { "graph-format",    required_argument, 0, 'f' },
+        { "hierarchical",    no_argument,       0, 'H' },
+        { "compress",        no_argument,       0, 'z' },
+        { "fuse-rn",         no_argument,       0, OPT_FUSE_RN },
+        { "fuse-pure",       no_argument,       0, OPT_FUSE_PURE },
+        { "latency-report",  no_argument,       0, OPT_LATENCY_REPORT },
+        { "wcet",            required_argument, 0, OPT_WCET },
+        { "tt-schedule",     no_argument,       0, OPT_TT_SCHEDULE },
+        { "prio-inherit",    no_argument,       0, OPT_PRIO_INHERIT },
+        { "prio-decay",      required_argument, 0, OPT_PRIO_DECAY },
+        { "max-errors",      required_argument, 0, OPT_MAX_ERRORS },
+        { "dot-view",        required_argument, 0, OPT_DOT_VIEW },
+        { "dot-max-vertices", required_argument, 0, OPT_DOT_MAX_VERTICES },
+        { "mem-layout",      no_argument,       0, OPT_MEM_LAYOUT },
+        { "msg-size",        required_argument, 0, OPT_MSG_SIZE },
+        { "renumber",        no_argument,       0, OPT_RENUMBER },
+        { "inst-path",       no_argument,       0, OPT_INST_PATH },
+        { "diff-against",    required_argument, 0, OPT_DIFF_AGAINST },
         { 0,                 0,                 0,  0  }
     };
 
     while( 1 )
     {
         option_index = 0;
-        c = getopt_long( argc, argv, "hVs:Sp:o:f:l:", long_options,
+        c = getopt_long( argc, argv, "hVs:Sap:o:f:Hzl:j:", long_options,
                 &option_index );
         if( c == -1 )
             break;
@@ -140,12 +308,18 @@ int main( int argc, char **argv )
             case 's':
                 sia_desc_file = optarg;
                 break;
+            case 'j':
+                __smxc_jobs = atoi( optarg );
+                break;
             case 'l':
                 __smxc_min_ch_len = atoi( optarg );
                 break;
             case 'S':
                 skip_sia = true;
                 break;
+            case 'a':
+                sia_archive = true;
+                break;
             case 'p':
                 build_path = optarg;
                 break;
@@ -155,6 +329,59 @@ int main( int argc, char **argv )
             case 'f':
                 format = optarg;
                 break;
+            case 'H':
+                hierarchical = true;
+                break;
+            case 'z':
+                compress = true;
+                break;
+            case OPT_FUSE_RN:
+                fuse_rn = true;
+                break;
+            case OPT_FUSE_PURE:
+                fuse_pure = true;
+                break;
+            case OPT_LATENCY_REPORT:
+                latency_report = true;
+                break;
+            case OPT_WCET:
+                wcet_file = optarg;
+                break;
+            case OPT_TT_SCHEDULE:
+                tt_schedule = true;
+                break;
+            case OPT_PRIO_INHERIT:
+                prio_inherit = true;
+                break;
+            case OPT_PRIO_DECAY:
+                prio_decay = atoi( optarg );
+                break;
+            case OPT_MAX_ERRORS:
+                __smxc_max_errors = atoi( optarg );
+                break;
+            case OPT_DOT_VIEW:
+                dot_view = optarg;
+                break;
+            case OPT_DOT_MAX_VERTICES:
+                dot_max_vertices = atoi( optarg );
+                dot_max_given = true;
+                break;
+            case OPT_MEM_LAYOUT:
+                mem_layout = true;
+                break;
+            case OPT_MSG_SIZE:
+                msg_size_file = optarg;
+                break;
+            case OPT_RENUMBER:
+                renumber = true;
+                break;
+            case OPT_INST_PATH:
+                inst_path = true;
+                break;
+            case OPT_DIFF_AGAINST:
+                diff_file = optarg;
+                inst_path = true;
+                break;
             case '?':
                 break;
             default:
@@ -184,6 +411,49 @@ int main( int argc, char **argv )
         return -1;
     }
 
+    if( __smxc_jobs <= 0 ) {
+        fprintf( stderr, "The argument of '-j' must be a positive integer,"
+                " '%d' provided\n", __smxc_jobs );
+        return -1;
+    }
+#ifndef SMXC_THREADS
+    if( __smxc_jobs > 1 ) {
+        fprintf( stderr, "Compiled without thread support, ignoring '-j'\n" );
+        __smxc_jobs = 1;
+    }
+#endif // SMXC_THREADS
+
+    if( dot_view != NULL && strcmp( dot_view, DOT_VIEW_INST ) != 0
+            && strcmp( dot_view, DOT_VIEW_COLLAPSED ) != 0 ) {
+        fprintf( stderr, "The argument of '--dot-view' must be either '%s' or"
+                " '%s', '%s' provided\n", DOT_VIEW_INST, DOT_VIEW_COLLAPSED,
+                dot_view );
+        return -1;
+    }
+
+    // the templates of -H are not transformed by these options
+    if( fuse_rn ) opt_flat = "--fuse-rn";
+    else if( fuse_pure ) opt_flat = "--fuse-pure";
+    else if( renumber ) opt_flat = "--renumber";
+    else if( mem_layout ) opt_flat = "--mem-layout";
+    if( hierarchical && ( opt_flat != NULL ) ) {
+        fprintf( stderr, "The option '-H' cannot be combined with '%s'\n",
+                opt_flat );
+        return -1;
+    }
+
+    if( dot_max_vertices <= 0 ) {
+        fprintf( stderr, "The argument of '--dot-max-vertices' must be a"
+                " positive integer, '%d' provided\n", dot_max_vertices );
+        return -1;
+    }
+
+    if( prio_decay < 0 ) {
+        fprintf( stderr, "The argument of '--prio-decay' must be a"
+                " non-negative integer, '%d' provided\n", prio_decay );
+        return -1;
+    }
+
     for( i = 0; i < 4; i++ )
     {
         if( __smxc_time_criticality_prio[i] <= 0 )
@@ -201,6 +471,16 @@ int main( int argc, char **argv )
     file_name[ name_size ] = '\0';
 
     if( format == NULL ) format = G_FMT_GRAPHML;
+    // SIAs and templates are always graphs
+    graph_format = format;
+    if( strcmp( format, G_FMT_C ) == 0 ) {
+        if( hierarchical ) {
+            fprintf( stderr, "The option '-H' cannot be combined with"
+                    " '-f %s'\n", G_FMT_C );
+            return -1;
+        }
+        graph_format = G_FMT_GRAPHML;
+    }
     if( build_path == NULL ) build_path = "./build";
     mkdir( build_path, 0755 );
 
@@ -212,15 +492,16 @@ int main( int argc, char **argv )
         return -1;
     }
     if( out_file_name == NULL ) {
-        out_file_path = malloc( strlen( build_path ) + strlen( format ) + strlen( file_name ) + 3 );
+        out_file_path = malloc( strlen( build_path ) + strlen( format )
+                + strlen( file_name ) + strlen( SMXZ_SUFFIX ) + 3 );
         sprintf( out_file_path, "%s/%s.%s", build_path, file_name, format );
     }
     else {
         out_file_path = malloc( strlen( build_path ) + strlen( out_file_name )
-                + 2 );
+                + strlen( SMXZ_SUFFIX ) + 2 );
         sprintf( out_file_path, "%s/%s", build_path, out_file_name );
     }
-    out_file = fopen( out_file_path, "w" );
+    if( compress ) strcat( out_file_path, SMXZ_SUFFIX );
     // set flex to read from it instead of defaulting to STDIN
     yyin = src_smx;
 
@@ -229,12 +510,99 @@ int main( int argc, char **argv )
         yyparse( &ast );
     } while( !feof( yyin ) );
     fclose( src_smx );
+    smxerr_flush();
 
-    if( ast == NULL ) return -1;
+    if( ast == NULL ) {
+        smxerr_destroy();
+        return -1;
+    }
 
     // CHECK SMX CONTEXT
     igraph_empty( &g, 0, true );
-    check_context( ast, &symtab, &g );
+    // the dot views are drawn from the hierarchical view
+    check_context( ast, &symtab, &g,
+            ( hierarchical || dot_view != NULL ) ? &hier : NULL );
+    smxerr_flush();
+#ifdef DOT_AST
+    mkdir( DOT_FOLDER, 0755 );
+    draw_ast_graph( ast );
+#endif // DOT_AST
+    // the AST is not needed anymore, release it to lower the peak memory
+    ast_destroy( ast );
+
+    // the graph of an erroneous program is incomplete, neither optimise,
+    // analyse, nor write it
+    is_valid = !smxerr_has_errors();
+
+    // OPTIMISE SMX GRAPH
+    if( is_valid && fuse_rn ) {
+        fuse_cnt = smxopt_fuse_rn( &g );
+        printf( " Routing node fusion: %d routing node(s) eliminated\n",
+                fuse_cnt );
+    }
+    if( is_valid && fuse_pure ) {
+        fuse_cnt = smxopt_fuse_pure( &g );
+        printf( " Pure box fusion: %d box(es) eliminated\n", fuse_cnt );
+    }
+    if( is_valid && renumber ) {
+        span = smxopt_span( &g );
+        fuse_cnt = smxopt_renumber( &g );
+        printf( " Renumbering: %d vertex(es) moved, channel span %ld -> %ld\n",
+                fuse_cnt, span, smxopt_span( &g ) );
+    }
+
+    // ANALYSE SMX GRAPH
+    if( is_valid ) smxana_channel_class( &g );
+    if( is_valid && prio_inherit ) {
+        prio_from = malloc( sizeof( int ) * ( igraph_vcount( &g ) + 1 ) );
+        prio_cnt = smxana_prio_inherit( &g, prio_decay, prio_from );
+        printf( " Priority inheritance: %d vertex(es) raised\n", prio_cnt );
+        smxana_prio_print( &g, prio_from );
+        free( prio_from );
+    }
+    if( is_valid && latency_report ) {
+        if( wcet_file != NULL && smxana_wcet_read( wcet_file, &wcets ) != 0 )
+            return -1;
+        smxana_latency( &g, wcets, &lat );
+        smxana_latency_print( &g, &lat );
+        report_path = malloc( strlen( build_path ) + strlen( file_name )
+                + strlen( "/_latency.json" ) + 1 );
+        sprintf( report_path, "%s/%s_latency.json", build_path, file_name );
+        report_file = fopen( report_path, "w" );
+        if( report_file != NULL ) {
+            smxana_latency_write( &g, &lat, report_file );
+            fclose( report_file );
+        }
+        else printf( "Cannot open file '%s'!\n", report_path );
+        smxana_latency_destroy( &lat );
+        smxana_wcet_destroy( &wcets );
+    }
+    if( is_valid && tt_schedule ) {
+        sched_path = malloc( strlen( build_path ) + strlen( file_name )
+                + strlen( "/_schedule.json" ) + 1 );
+        sprintf( sched_path, "%s/%s_schedule.json", build_path, file_name );
+        report_file = fopen( sched_path, "w" );
+        if( report_file != NULL ) {
+            sched_cnt = smxana_tt_schedule( &g, report_file );
+            fclose( report_file );
+            printf( " TT schedule: %d group(s) written to '%s'\n", sched_cnt,
+                    sched_path );
+        }
+        else printf( "Cannot open file '%s'!\n", sched_path );
+    }
+
+    footprint_cnt = is_valid ? smxmem_footprint( &g, &footprint ) : 0;
+    if( footprint_cnt > 0 )
+        smxmem_footprint_print( footprint_cnt, footprint );
+
+    if( is_valid && mem_layout ) {
+        if( msg_size_file != NULL
+                && smxmem_msg_size_read( msg_size_file, &msg_sizes ) != 0 )
+            return -1;
+        smxmem_layout( &g, msg_sizes, &layout );
+        smxmem_layout_print( &layout );
+        smxmem_msg_size_destroy( &msg_sizes );
+    }
 
     // PARSE SIA FILE
     if( sia_desc_file != NULL ) {
@@ -260,49 +628,134 @@ int main( int argc, char **argv )
     }
 
     // CREATE SIAs WHERE NO DESCRIPTION EXISTS
-    if( !skip_sia ) {
+    if( !skip_sia && !smxerr_has_errors() ) {
         smx2sia( &g, &sia_smx_symbols, &sia_desc_symbols );
-        build_path_sia = malloc( strlen( build_path ) + 5 );
-        sprintf( build_path_sia, "%s/sia", build_path );
-        mkdir( build_path_sia, 0755 );
-        smx2sia_sias_write( &sia_smx_symbols, build_path_sia, format );
+        if( sia_archive ) {
+            build_path_sia = malloc( strlen( build_path )
+                    + strlen( SIA_ARCHIVE_NAME ) + 2 );
+            sprintf( build_path_sia, "%s/%s", build_path, SIA_ARCHIVE_NAME );
+            sia_cnt = smx2sia_archive_write( &sia_smx_symbols, build_path_sia,
+                    graph_format, compress );
+            if( sia_cnt >= 0 )
+                printf( " SIA archive: %d SIA(s) written to '%s'\n", sia_cnt,
+                        build_path_sia );
+        }
+        else {
+            build_path_sia = malloc( strlen( build_path ) + 5 );
+            sprintf( build_path_sia, "%s/sia", build_path );
+            mkdir( build_path_sia, 0755 );
+            smx2sia_sias_write( &sia_smx_symbols, build_path_sia,
+                    graph_format, compress );
+        }
     }
 
     // WRITE OUT SMX
     dgraph_destroy_attr( &g );
+#ifdef DOT_CON
+    // the instance paths are needed to collapse the nets of a large graph,
+    // the port connection graph is only limited on request
+    mkdir( DOT_FOLDER, 0755 );
+    smxhier_dot_write( &g, P_CON_DOT_PATH,
+            dot_max_given ? dot_max_vertices : 0 );
+#endif // DOT_CON
+    if( !inst_path ) dgraph_destroy_attr_v( &g, GV_PATH );
 
-    if( strcmp( format, G_FMT_GML ) == 0 ) {
-        igraph_write_graph_gml( &g, out_file, NULL, G_GML_HEAD );
+    if( is_valid && hierarchical ) {
+        build_path_tpl = malloc( strlen( build_path )
+                + strlen( TPL_FOLDER ) + 2 );
+        sprintf( build_path_tpl, "%s/%s", build_path, TPL_FOLDER );
+        mkdir( build_path_tpl, 0755 );
     }
-    else if( strcmp( format, G_FMT_GRAPHML ) == 0 ) {
-        igraph_write_graph_graphml( &g, out_file, 0 );
+
+    if( is_valid ) {
+        if( compress ) out_file = smxz_fopen( out_file_path, "w" );
+        else out_file = fopen( out_file_path, "w" );
+        if( strcmp( format, G_FMT_GML ) == 0 ) {
+            igraph_write_graph_gml( hierarchical ? &hier.g : &g, out_file, NULL,
+                    G_GML_HEAD );
+        }
+        else if( strcmp( format, G_FMT_GRAPHML ) == 0 ) {
+            igraph_write_graph_graphml( hierarchical ? &hier.g : &g, out_file,
+                    0 );
+        }
+        else if( strcmp( format, G_FMT_C ) == 0 ) {
+            smxcgen_write( &g, out_file, file_name );
+        }
+        else {
+            printf( "Unknown format '%s'!\n", format );
+            return -1;
+        }
+
+        fclose( out_file );
     }
-    else {
-        printf( "Unknown format '%s'!\n", format );
-        return -1;
+
+    if( is_valid && hierarchical ) {
+        tpl_cnt = smxhier_write_tpls( &hier, build_path_tpl, graph_format,
+                compress );
+        printf( " Hierarchical output: %d template(s) written to '%s'\n",
+                tpl_cnt, build_path_tpl );
     }
 
-    fclose( out_file );
+    // DIFF AGAINST THE PREVIOUS GRAPH
+    if( is_valid && diff_file != NULL ) {
+        if( smxz_format( diff_file ) == NULL ) {
+            printf( "Unknown format of the graph '%s'!\n", diff_file );
+            return -1;
+        }
+        if( smxz_read_graph( &g_old, diff_file,
+                    smxz_format( diff_file ) ) != 0 )
+            return -1;
+        if( smxdiff_compute( &g_old, &g, &diff ) != 0 ) {
+            fprintf( stderr, "The graph '%s' has no instance paths, compile it"
+                    " with '--inst-path'!\n", diff_file );
+            igraph_destroy( &g_old );
+            return -1;
+        }
+        smxdiff_print( &diff );
+        diff_path = malloc( strlen( build_path ) + strlen( file_name )
+                + strlen( "/_diff.json" ) + 1 );
+        sprintf( diff_path, "%s/%s_diff.json", build_path, file_name );
+        report_file = fopen( diff_path, "w" );
+        if( report_file != NULL ) {
+            smxdiff_write( &diff, report_file );
+            fclose( report_file );
+            printf( " Graph diff written to '%s'\n", diff_path );
+        }
+        else printf( "Cannot open file '%s'!\n", diff_path );
+        smxdiff_destroy( &diff );
+        igraph_destroy( &g_old );
+    }
 
+    smxerr_flush();
     if( yynerrs > 0 ) printf( " Error count: %d\n", yynerrs );
-#ifdef DOT_CON
-    mkdir( DOT_FOLDER, 0755 );
-    out_file = fopen( P_CON_DOT_PATH, "w" );
-    igraph_write_graph_dot( &g, out_file );
-    fclose( out_file );
-#endif // DOT_CON
-#ifdef DOT_AST
-    draw_ast_graph( ast );
-#endif // DOT_AST
-
+    if( dot_view != NULL ) {
+        mkdir( DOT_FOLDER, 0755 );
+        if( strcmp( dot_view, DOT_VIEW_INST ) == 0 ) {
+            dot_cnt = smxhier_dot_write_insts( &hier, DOT_FOLDER,
+                    dot_max_vertices );
+            printf( " DOT view: %d net instance(s) written to '%s'\n",
+                    dot_cnt, DOT_FOLDER );
+        }
+        else {
+            if( smxhier_dot_write_view( &hier, &hier.g, C_CON_DOT_PATH,
+                        dot_max_vertices ) == 0 )
+                printf( " DOT view: collapsed graph written to '%s'\n",
+                        C_CON_DOT_PATH );
+        }
+    }
     // cleanup
     free( out_file_path );
+    free( report_path );
+    free( sched_path );
+    free( diff_path );
     free( build_path_sia );
+    free( build_path_tpl );
     free( file_name );
     igraph_destroy( &g );
+    if( hierarchical || dot_view != NULL ) smxhier_destroy( &hier );
     smx2sia_sias_destroy( sias, &sia_desc_symbols, &sia_smx_symbols );
-    ast_destroy( ast );
     symrec_del_all( &symtab );
+    smxerr_destroy();
     yylex_destroy();
 
     return 0;
@@ -6,6 +6,7 @@
  *
  */
 
+#include <math.h>
 #include "context.h"
 #include "defines.h"
 #include "smxgraph.h"
@@ -86,6 +87,13 @@ void check_connection_cp( virt_net_t* v_net, virt_port_t* port1,
     virt_net_t* v_net_sync = NULL;
     instrec_t* inst1 = port1->v_net->inst;
     instrec_t* inst2 = port2->v_net->inst;
+    // the dispatchers and collectors of farms are connected like boxes
+    bool is_rn1 = ( inst1->type == INSTREC_SYNC )
+        && dgraph_vertex_is_farm_rn( g, inst1->id );
+    bool is_rn2 = ( inst2->type == INSTREC_SYNC )
+        && dgraph_vertex_is_farm_rn( g, inst2->id );
+    bool is_sync1 = ( inst1->type == INSTREC_SYNC ) && !is_rn1;
+    bool is_sync2 = ( inst2->type == INSTREC_SYNC ) && !is_rn2;
     virt_port_t* port_new;
     port_class_t port_class;
     port_mode_t port_mode;
@@ -128,13 +136,17 @@ void check_connection_cp( virt_net_t* v_net, virt_port_t* port1,
             }
         }
         // connect ports and cerate copy synchronizer if necessary
-        if( ( inst1->type == INSTREC_SYNC )
-                && ( inst2->type == INSTREC_SYNC ) ) {
+        if( is_sync1 && is_sync2 ) {
             // merge copy synchronizers
             cpsync_merge( port1, port2, g );
         }
-        else if( ( inst1->type == INSTREC_SYNC )
-                || ( inst2->type == INSTREC_SYNC ) ) {
+        else if( is_sync1 && is_rn2 ) {
+            connect_ports_cp( port1, port2, g );
+        }
+        else if( is_rn1 && is_sync2 ) {
+            connect_ports_cp( port2, port1, g );
+        }
+        else if( is_sync1 || is_sync2 ) {
             connect_ports( port1, port2, g, false );
         }
         else {
@@ -149,14 +161,16 @@ void check_connection_cp( virt_net_t* v_net, virt_port_t* port1,
             dgraph_vertex_add_attr_tt( g, v_net_sync->inst->id,
                     get_time_criticality_prio( tc, false ) );
             // channel length is set to zero: the connecting box port might
-            // overwrite this due to the max function
+            // overwrite this due to the max function. The message size is
+            // taken from any of the two ports and checked on connection.
             port_new = virt_port_create( port_class, port_mode, v_net_sync,
                     port1->name, port1->symb, tb, TIME_NONE, false, false,
-                    false, 0 );
+                    false, 0, ( port1->msg_size > 0 ) ? port1->msg_size
+                        : port2->msg_size );
             virt_port_append( v_net_sync, port_new );
             virt_port_append( v_net, port_new );
-            connect_ports( port_new, port1, g, false );
-            connect_ports( port_new, port2, g, false );
+            connect_ports_cp( port_new, port1, g );
+            connect_ports_cp( port_new, port2, g );
         }
     }
     else {
@@ -188,30 +202,32 @@ void check_connection_missing( virt_net_t* v_net_l, virt_net_t* v_net_r,
 {
     int i, j;
     char error_msg[ CONST_ERROR_LEN ];
-    igraph_vs_t vs1, vs2;
-    igraph_vector_t v1, v2;
+    igraph_vector_t v1, v2, reach_out, reach_in;
     instrec_t *inst1, *inst2;
-    igraph_matrix_t res1, res2;
+    bool has_farm_rn = igraph_cattribute_has_attr( g, IGRAPH_ATTRIBUTE_VERTEX,
+            GV_FARM_RN );
     igraph_vector_init( &v1, 0 );
     igraph_vector_init( &v2, 0 );
+    igraph_vector_init( &reach_out, 0 );
+    igraph_vector_init( &reach_in, 0 );
     dgraph_vptr_to_v( &v_net_l->con->right, &v1 );
     dgraph_vptr_to_v( &v_net_r->con->left, &v2 );
-    igraph_matrix_init( &res1, igraph_vector_size( &v1 ),
-            igraph_vector_size( &v2 ) );
-    igraph_matrix_init( &res2, igraph_vector_size( &v1 ),
-            igraph_vector_size( &v2 ) );
-    igraph_vs_vector( &vs1, &v1 );
-    igraph_vs_vector( &vs2, &v2 );
-    igraph_shortest_paths( g, &res1, vs1, vs2, IGRAPH_OUT );
-    igraph_shortest_paths( g, &res2, vs1, vs2, IGRAPH_IN );
 
     for( i=0; i<igraph_vector_size( &v1 ); i++ ) {
+        // only the close neighbourhood matters, the search is bounded such
+        // that it does not grow with the size of the net
+        check_connection_missing_reach( g, VECTOR( v1 )[i], IGRAPH_OUT,
+                has_farm_rn, &reach_out );
+        check_connection_missing_reach( g, VECTOR( v1 )[i], IGRAPH_IN,
+                has_farm_rn, &reach_in );
         for( j=0; j<igraph_vector_size( &v2 ); j++ ) {
 #if defined(DEBUG) || defined(DEBUG_CONNECT_MISSING)
             printf(" check ids %d and %d\n", ( int )VECTOR( v1 )[i],
                     ( int )VECTOR( v2 )[j]);
 #endif // DEBUG_CONNECT_MISSING
-            if( ( MATRIX( res1, i, j ) > 2 ) && ( MATRIX( res2, i, j ) > 2 ) ) {
+            if( !igraph_vector_binsearch( &reach_out, VECTOR( v2 )[j], NULL )
+                    && !igraph_vector_binsearch( &reach_in, VECTOR( v2 )[j],
+                        NULL ) ) {
                 inst1 = VECTOR( v_net_l->con->right )[i];
                 inst2 = VECTOR( v_net_r->con->left )[j];
                 // ERROR: there is no connection between the two nets
@@ -228,10 +244,82 @@ void check_connection_missing( virt_net_t* v_net_l, virt_net_t* v_net_r,
 
     igraph_vector_destroy( &v1 );
     igraph_vector_destroy( &v2 );
-    igraph_matrix_destroy( &res1 );
-    igraph_matrix_destroy( &res2 );
-    igraph_vs_destroy( &vs1 );
-    igraph_vs_destroy( &vs1 );
+    igraph_vector_destroy( &reach_out );
+    igraph_vector_destroy( &reach_in );
+}
+
+/******************************************************************************/
+void check_connection_missing_reach( igraph_t* g, int id,
+        igraph_neimode_t mode, bool has_farm_rn, igraph_vector_t* reach )
+{
+    int i, j, dist, id_nbr;
+    long int pos;
+    igraph_vector_t level, next, nbrs;
+    igraph_vector_init( &level, 0 );
+    igraph_vector_init( &next, 0 );
+    igraph_vector_init( &nbrs, 0 );
+    igraph_vector_clear( reach );
+    igraph_vector_push_back( reach, id );
+    igraph_vector_push_back( &level, id );
+
+    for( dist = 0; dist <= CONST_CON_DIST; dist++ ) {
+        // the level grows while it is walked: a channel between two routing
+        // nodes of a farm does not add to the distance
+        for( i = 0; i < igraph_vector_size( &level ); i++ ) {
+            igraph_neighbors( g, &nbrs, VECTOR( level )[i], mode );
+            for( j = 0; j < igraph_vector_size( &nbrs ); j++ ) {
+                id_nbr = VECTOR( nbrs )[j];
+                if( has_farm_rn
+                        && dgraph_vertex_is_farm_rn( g, VECTOR( level )[i] )
+                        && dgraph_vertex_is_farm_rn( g, id_nbr ) ) {
+                    if( igraph_vector_binsearch( reach, id_nbr, &pos ) )
+                        continue;
+                    igraph_vector_insert( reach, pos, id_nbr );
+                    igraph_vector_push_back( &level, id_nbr );
+                }
+                else if( dist < CONST_CON_DIST )
+                    igraph_vector_push_back( &next, id_nbr );
+            }
+        }
+        igraph_vector_clear( &level );
+        for( i = 0; i < igraph_vector_size( &next ); i++ ) {
+            if( igraph_vector_binsearch( reach, VECTOR( next )[i], &pos ) )
+                continue;
+            igraph_vector_insert( reach, pos, VECTOR( next )[i] );
+            igraph_vector_push_back( &level, VECTOR( next )[i] );
+        }
+        igraph_vector_clear( &next );
+    }
+
+    igraph_vector_destroy( &level );
+    igraph_vector_destroy( &next );
+    igraph_vector_destroy( &nbrs );
+}
+
+/******************************************************************************/
+bool check_connection_msg_size( virt_port_t* port_l, virt_port_t* port_r )
+{
+    instrec_t *inst_l, *inst_r;
+    char error_msg[ CONST_ERROR_LEN ];
+    inst_l = port_l->v_net->inst;
+    inst_r = port_r->v_net->inst;
+
+    if( ( port_l->msg_size > 0 ) && ( port_r->msg_size > 0 )
+            && ( port_l->msg_size != port_r->msg_size ) ) {
+#if defined(DEBUG) || defined(DEBUG_CONNECT)
+        printf( "\n  => connection is invalid (bad message size)\n" );
+#endif // DEBUG_CONNECT
+        sprintf( error_msg, ERROR_BAD_MSG_SIZE, ERR_ERROR, port_l->name,
+                inst_l->name, inst_l->id, port_l->msg_size, port_r->name,
+                inst_r->name, inst_r->id, port_r->msg_size );
+        report_yyerror( error_msg, inst_r->line );
+        return false;
+    }
+    if( ( inst_l->type == INSTREC_SYNC ) && ( port_l->msg_size == 0 ) )
+        port_l->msg_size = port_r->msg_size;
+    if( ( inst_r->type == INSTREC_SYNC ) && ( port_r->msg_size == 0 ) )
+        port_r->msg_size = port_l->msg_size;
+    return true;
 }
 
 /******************************************************************************/
@@ -398,13 +486,15 @@ void check_connections_self( igraph_t* g, virt_net_t* v_net )
 }
 
 /******************************************************************************/
-void check_context( ast_node_t* ast, symrec_t** symtab, igraph_t* g )
+void check_context( ast_node_t* ast, symrec_t** symtab, igraph_t* g,
+        hier_t* hier )
 {
     UT_array* scope_stack = NULL; // stack to handle the scope
     attr_net_t* n_attr = NULL;
     int scope = 0;
     igraph_t g_tmp;
     int i;
+    bool is_valid;
 
     igraph_vector_ptr_init( &__rm_cp, 0 );
     utarray_new( scope_stack, &ut_int_icd );
@@ -412,7 +502,17 @@ void check_context( ast_node_t* ast, symrec_t** symtab, igraph_t* g )
     n_attr = check_context_ast( symtab, scope_stack, ast, &scope );
 
     utarray_free( scope_stack );
-    if( n_attr->v_net != NULL ) {
+    // there is no point in flattening a net with errors
+    is_valid = ( n_attr->v_net != NULL ) && !smxerr_has_errors();
+    if( hier != NULL ) {
+        // export the net templates before the top-level net is destroyed
+        if( is_valid ) smxhier_init( &n_attr->g, hier );
+        else {
+            igraph_empty( &hier->g, 0, IGRAPH_DIRECTED );
+            hier->tpls = NULL;
+        }
+    }
+    if( is_valid ) {
         // flatten graph and detect open ports
         igraph_empty( &g_tmp, 0, IGRAPH_DIRECTED );
         dgraph_append( &g_tmp, &n_attr->g, true );
@@ -523,6 +623,7 @@ void* check_context_ast( symrec_t** symtab, UT_array* scope_stack,
             igraph_empty( &g_net, 0, true );
             v_net = ( void* )install_nets( symtab, scope_stack,
                     ast->network->net, &g_net, TIME_CTITICALITY_NONE );
+            dgraph_merge_mark_clear( &g_net );
             n_attr = symrec_attr_create_net( v_net, &g_net );
 #if defined(DEBUG) || defined(DEBUG_NET_DOT)
             igraph_write_graph_dot( &g_net, stdout );
@@ -616,9 +717,11 @@ void* check_context_ast( symrec_t** symtab, UT_array* scope_stack,
         case AST_PORT:
             // prepare symbol attributes and create symbol
             p_attr = symrec_attr_create_port( NULL, PORT_MODE_BI,
-                    PORT_CLASS_NONE, false, false, false, 0 );
+                    PORT_CLASS_NONE, false, false, false, 0, 0 );
             if( ast->port->ch_len != NULL )
                 p_attr->ch_len = ast->port->ch_len->attr->val;
+            if( ast->port->msg_size != NULL )
+                p_attr->msg_size = ast->port->msg_size->attr->val;
             if( ast->port->mode != NULL )
                 p_attr->mode = ast->port->mode->attr->val;
             if( ast->port->collection != NULL )
@@ -648,7 +751,9 @@ void* check_context_ast( symrec_t** symtab, UT_array* scope_stack,
             else if( ( ast->port->int_id != NULL )
                     && ( ast->port->int_id->type == AST_ID ) ) {
                 // alternative port name
-                p_attr->alt_name = ast->port->int_id->symbol->name;
+                p_attr->alt_name = malloc(
+                        strlen( ast->port->int_id->symbol->name ) + 1 );
+                strcpy( p_attr->alt_name, ast->port->int_id->symbol->name );
             }
             rec = symrec_create_port( ast->port->id->symbol->name,
                     *( int* )utarray_back( scope_stack ), ast->port->id->symbol->line,
@@ -787,6 +892,88 @@ bool check_cpsync_merge( double v1_out, double v1_in, double v2_out,
     return res;
 }
 
+/******************************************************************************/
+void check_msg_size_cp( igraph_t* g )
+{
+    int vid, i, size, size_ch;
+    char error_msg[ CONST_ERROR_LEN ];
+    igraph_vector_t eids;
+    virt_net_t* v_net;
+
+    if( !igraph_cattribute_has_attr( g, IGRAPH_ATTRIBUTE_EDGE, GE_MSG_SIZE ) )
+        return;
+
+    igraph_vector_init( &eids, 0 );
+    for( vid = 0; vid < igraph_vcount( g ); vid++ ) {
+        v_net = ( virt_net_t* )( uintptr_t )igraph_cattribute_VAN( g,
+                GV_VNET, vid );
+        if( v_net->type != VNET_SYNC ) continue;
+        igraph_incident( g, &eids, vid, IGRAPH_ALL );
+        size = 0;
+        for( i = 0; i < igraph_vector_size( &eids ); i++ ) {
+            size_ch = igraph_cattribute_EAN( g, GE_MSG_SIZE,
+                    VECTOR( eids )[i] );
+            if( size == 0 ) size = size_ch;
+            else if( size_ch != size ) {
+                sprintf( error_msg, ERROR_BAD_MSG_SIZE_CP, ERR_ERROR, size,
+                        size_ch, v_net->inst->name, v_net->inst->id );
+                // routing nodes have no line, report the declaring port
+                report_yyerror( error_msg, check_msg_size_cp_line( g, vid,
+                            size_ch ) );
+                break;
+            }
+        }
+    }
+    igraph_vector_destroy( &eids );
+}
+
+/******************************************************************************/
+int check_msg_size_cp_line( igraph_t* g, int vid, int size )
+{
+    int i, eid, id, id_next, head = 0, tail = 0, line = 0;
+    int v_cnt = igraph_vcount( g );
+    int* queue = malloc( sizeof( int ) * ( v_cnt + 1 ) );
+    bool* is_reached = calloc( v_cnt + 1, sizeof( bool ) );
+    igraph_integer_t id_src, id_dst;
+    igraph_vector_t eids;
+    virt_net_t* v_net;
+    virt_port_t* port;
+
+    // breadth-first search along the routing nodes for the closest box port
+    // with the given size, the size was propagated from there
+    igraph_vector_init( &eids, 0 );
+    queue[tail++] = vid;
+    is_reached[vid] = true;
+    while( ( head < tail ) && ( line == 0 ) ) {
+        id = queue[head++];
+        igraph_incident( g, &eids, id, IGRAPH_ALL );
+        for( i = 0; i < igraph_vector_size( &eids ); i++ ) {
+            eid = VECTOR( eids )[i];
+            if( igraph_cattribute_EAN( g, GE_MSG_SIZE, eid ) != size )
+                continue;
+            igraph_edge( g, eid, &id_src, &id_dst );
+            id_next = ( id_src == id ) ? id_dst : id_src;
+            port = ( virt_port_t* )( uintptr_t )igraph_cattribute_EAN( g,
+                    ( id_src == id ) ? GE_PDST : GE_PSRC, eid );
+            v_net = ( virt_net_t* )( uintptr_t )igraph_cattribute_VAN( g,
+                    GV_VNET, id_next );
+            if( v_net->type != VNET_SYNC ) {
+                line = ( port->symb != NULL ) ? port->symb->line
+                    : v_net->inst->line;
+                break;
+            }
+            if( !is_reached[id_next] ) {
+                is_reached[id_next] = true;
+                queue[tail++] = id_next;
+            }
+        }
+    }
+    igraph_vector_destroy( &eids );
+    free( queue );
+    free( is_reached );
+    return line;
+}
+
 /******************************************************************************/
 void check_ports_decoupled( symrec_list_t* ports )
 {
@@ -833,6 +1020,9 @@ bool check_prototype( symrec_list_t* r_ports, virt_net_t* v_net, char *name )
 {
     char error_msg[ CONST_ERROR_LEN ];
     bool res = true;
+    char* note;
+    size_t note_len;
+    FILE* note_file;
 
 #if defined(DEBUG) || defined(DEBUG_PROTO)
     printf( "check_prototype:\n" );
@@ -842,13 +1032,19 @@ bool check_prototype( symrec_list_t* r_ports, virt_net_t* v_net, char *name )
     debug_print_vports( v_net );
 #endif // DEBUG_PROTO
     if( !do_port_cnts_match( r_ports, v_net->ports )
-        || !do_port_attrs_match( r_ports, v_net->ports ) ) {
+        || !do_port_attrs_match( r_ports, v_net ) ) {
         sprintf( error_msg, ERROR_TYPE_CONFLICT, ERR_ERROR, name );
-        report_yyerror( error_msg, r_ports->rec->line );
-        printf( " net:\n  " );
-        debug_print_vports_s( v_net, false );
-        printf( " prototype:\n  " );
-        debug_print_rports( r_ports, name );
+        if( report_yyerror( error_msg, r_ports->rec->line ) ) {
+            // the port lists are printed together with the error message
+            note_file = open_memstream( &note, &note_len );
+            fprintf( note_file, " net:\n  " );
+            debug_fprint_vports_s( note_file, v_net, false );
+            fprintf( note_file, " prototype:\n  " );
+            debug_fprint_rports( note_file, r_ports, name );
+            fclose( note_file );
+            report_note( note );
+            free( note );
+        }
         res = false;
     }
 
@@ -928,6 +1124,8 @@ void connect_ports( virt_port_t* port_l, virt_port_t* port_r, igraph_t* g,
     }
     else return;
 
+    // the channel is created anyway to avoid follow-up errors
+    check_connection_msg_size( port_l, port_r );
     // set port state
     if( ( inst_type_l != INSTREC_SYNC ) || connect_sync )
         port_l->state = VPORT_STATE_CONNECTED;
@@ -937,12 +1135,24 @@ void connect_ports( virt_port_t* port_l, virt_port_t* port_r, igraph_t* g,
     dgraph_edge_add( g, p_src, p_dest, name );
 }
 
+/******************************************************************************/
+void connect_ports_cp( virt_port_t* port_cp, virt_port_t* port, igraph_t* g )
+{
+    if( port->v_net->inst->type == INSTREC_SYNC ) {
+        // the routing node of a farm is the inner end of the connection
+        connect_ports( port, port_cp, g, false );
+        port->state = VPORT_STATE_CONNECTED;
+    }
+    else connect_ports( port_cp, port, g, false );
+}
+
 /******************************************************************************/
 void cpsync_merge( virt_port_t* port1, virt_port_t* port2, igraph_t* g )
 {
     int id_del;
     virt_net_t *v_net1 = port1->v_net;
     virt_net_t *v_net2 = port2->v_net;
+    virt_net_t *v_net_del;
 #if defined(DEBUG) || defined(DEBUG_CONNECT)
     printf( "Merge %s(%d) and %s(%d)\n", v_net1->inst->name, v_net1->inst->id,
             v_net2->inst->name, v_net2->inst->id );
@@ -953,14 +1163,21 @@ void cpsync_merge( virt_port_t* port1, virt_port_t* port2, igraph_t* g )
         port1->state = VPORT_STATE_DISABLED;
         port2->state = VPORT_STATE_CP_OPEN;
         virt_port_append_all( v_net2, v_net1, true );
-        igraph_vector_ptr_push_back( &__rm_cp, v_net1 );
+        v_net_del = v_net1;
     }
     else {
         port1->state = VPORT_STATE_CP_OPEN;
         port2->state = VPORT_STATE_DISABLED;
         virt_port_append_all( v_net1, v_net2, true );
-        igraph_vector_ptr_push_back( &__rm_cp, v_net2 );
+        v_net_del = v_net2;
     }
+#ifdef SMXC_THREADS
+    pthread_mutex_lock( &__smxc_lock );
+#endif // SMXC_THREADS
+    igraph_vector_ptr_push_back( &__rm_cp, v_net_del );
+#ifdef SMXC_THREADS
+    pthread_mutex_unlock( &__smxc_lock );
+#endif // SMXC_THREADS
     // adjust all ids starting from the id of the deleted record
     dgraph_vertex_update_ids( g, id_del );
 }
@@ -1029,10 +1246,10 @@ bool do_port_cnts_match( symrec_list_t* r_ports, virt_port_list_t* v_ports )
 }
 
 /******************************************************************************/
-bool do_port_attrs_match( symrec_list_t* r_ports, virt_port_list_t* v_ports )
+bool do_port_attrs_match( symrec_list_t* r_ports, virt_net_t* v_net )
 {
     symrec_list_t* r_port_ptr = r_ports;
-    virt_port_list_t* v_port_ptr = v_ports;
+    virt_port_list_t* v_port_ptr = NULL;
     attr_port_t* r_port_attr = NULL;
     bool match = false;
 
@@ -1045,9 +1262,15 @@ bool do_port_attrs_match( symrec_list_t* r_ports, virt_port_list_t* v_ports )
             continue;
         }
         match = false;
-        v_port_ptr = v_ports;
         r_port_attr = r_port_ptr->rec->attr_port;
+        v_port_ptr = v_net->ports;
         while( v_port_ptr != NULL  ) {
+            // a connected port of a farm replica is not a port of the net, its
+            // routing node port is
+            if( v_port_ptr->port->state >= VPORT_STATE_CONNECTED ) {
+                v_port_ptr = v_port_ptr->next;
+                continue;
+            }
             if( strlen( r_port_ptr->rec->name )
                     == strlen( v_port_ptr->port->name )
                 && strcmp( r_port_ptr->rec->name,
@@ -1106,8 +1329,8 @@ virt_net_t* install_nets( symrec_t** symtab, UT_array* scope_stack,
 {
     symrec_t* rec = NULL;
     virt_net_t* v_net = NULL;
-    virt_net_t* v_net1 = NULL;
     virt_net_t* v_net2 = NULL;
+    ast_list_t* list = NULL;
     char error_msg[ CONST_ERROR_LEN ];
 
     if( ast == NULL ) return NULL;
@@ -1115,42 +1338,29 @@ virt_net_t* install_nets( symrec_t** symtab, UT_array* scope_stack,
     switch( ast->type ) {
         case AST_PARALLEL:
         case AST_PARALLEL_DET:
-            v_net1 = install_nets( symtab, scope_stack, ast->op->left, g, tc );
-            if( v_net1 == NULL ) return NULL;
-            v_net2 = install_nets( symtab, scope_stack, ast->op->right, g, tc );
-            if( v_net2 == NULL ) {
-                virt_net_destroy_shallow( v_net1 );
-                return NULL;
-            }
-            v_net = virt_net_create_parallel( v_net1, v_net2 );
-            virt_net_destroy_shallow( v_net1 );
-            virt_net_destroy_shallow( v_net2 );
-            check_connections_cp( v_net, g, ast->type, tc );
-            break;
         case AST_SERIAL:
         case AST_SERIAL_PROP:
-            v_net1 = install_nets( symtab, scope_stack, ast->op->left, g, tc );
-            if( v_net1 == NULL ) return NULL;
-            v_net2 = install_nets( symtab, scope_stack, ast->op->right, g, tc );
-            if( v_net2 == NULL ) {
-                virt_net_destroy_shallow( v_net1 );
-                return NULL;
-            }
-            // check connections and update virtual net
-            check_connections( v_net1, v_net2, g );
-            post_process_merge( g );
-            /* force = ( ast->type == AST_SERIAL); */
-            if( ast->type == AST_SERIAL ) {
-                virt_net_update_class( v_net1, PORT_CLASS_UP );
-                virt_net_update_class( v_net2, PORT_CLASS_DOWN );
-                check_connections_open( v_net1, v_net2 );
+            // combine the operands from left to right
+            list = ast->op->ops;
+            v_net = install_nets( symtab, scope_stack, list->node, g, tc );
+            if( v_net == NULL ) return NULL;
+            for( list = list->next; list != NULL; list = list->next ) {
+                v_net2 = install_nets( symtab, scope_stack, list->node, g, tc );
+                if( v_net2 == NULL ) {
+                    virt_net_destroy_shallow( v_net );
+                    return NULL;
+                }
+                if( ( ast->type == AST_SERIAL )
+                        || ( ast->type == AST_SERIAL_PROP ) )
+                    v_net = install_nets_serial( v_net, v_net2, g, ast->type,
+                            tc );
+                else
+                    v_net = install_nets_parallel( v_net, v_net2, g,
+                            ast->type, tc );
             }
-            check_connection_missing( v_net1, v_net2, g,
-                    ast->type == AST_SERIAL_PROP );
-            v_net = virt_net_create_serial( v_net1, v_net2 );
-            virt_net_destroy_shallow( v_net1 );
-            virt_net_destroy_shallow( v_net2 );
-            check_connections_cp( v_net, g, AST_SERIAL, tc );
+            break;
+        case AST_FARM:
+            v_net = install_nets_farm( symtab, scope_stack, ast, g, tc );
             break;
         case AST_TB:
             v_net = install_nets( symtab, scope_stack, ast->time->op, g, tc );
@@ -1210,18 +1420,162 @@ virt_net_t* install_nets( symrec_t** symtab, UT_array* scope_stack,
     return v_net;
 }
 
+/******************************************************************************/
+virt_net_t* install_nets_farm( symrec_t** symtab, UT_array* scope_stack,
+        ast_node_t* ast, igraph_t* g, time_criticality_t tc )
+{
+    virt_net_t* v_net = NULL;
+    virt_net_t** v_nets;
+    virt_port_list_t** ports;
+    virt_port_t* port;
+    igraph_vector_ptr_t rn_ports;
+    int width = ast->farm->width;
+    int farm = dgraph_farm_add();
+    int replica, vid, vid_start, i;
+    char error_msg[ CONST_ERROR_LEN ];
+
+    v_nets = malloc( sizeof( virt_net_t* ) * width );
+    ports = malloc( sizeof( virt_port_list_t* ) * width );
+    if( v_nets == NULL || ports == NULL ) {
+        sprintf( error_msg, ERROR_FARM_ALLOC, ERR_ERROR, width );
+        report_yyerror( error_msg, ast->farm->line );
+        free( v_nets );
+        free( ports );
+        return NULL;
+    }
+    for( replica = 0; replica < width; replica++ ) {
+        vid_start = igraph_vcount( g );
+        v_nets[replica] = install_nets( symtab, scope_stack, ast->farm->op, g,
+                tc );
+        if( v_nets[replica] == NULL ) {
+            while( replica > 0 ) virt_net_destroy_shallow( v_nets[--replica] );
+            free( v_nets );
+            free( ports );
+            return NULL;
+        }
+        for( vid = vid_start; vid < igraph_vcount( g ); vid++ ) {
+            if( !dgraph_vertex_is_farm( g, vid ) ) {
+                igraph_cattribute_VAN_set( g, GV_FARM, vid, farm );
+                igraph_cattribute_VAN_set( g, GV_REPLICA, vid, replica );
+            }
+            else if( dgraph_vertex_get_farm( g, vid, GV_FARM_OUTER ) == 0 ) {
+                // a nested farm records the replica it is part of
+                igraph_cattribute_VAN_set( g, GV_FARM_OUTER, vid, farm );
+                igraph_cattribute_VAN_set( g, GV_REPLICA_OUTER, vid, replica );
+            }
+        }
+    }
+
+    // the replicas are installed alike, hence their port lists match: each
+    // open input is served by a dispatcher and each open output by a collector
+    igraph_vector_ptr_init( &rn_ports, 0 );
+    for( replica = 0; replica < width; replica++ )
+        ports[replica] = v_nets[replica]->ports;
+    while( ports[0] != NULL ) {
+        port = ports[0]->port;
+        if( ( port->state < VPORT_STATE_CONNECTED )
+                && ( port->attr_class != PORT_CLASS_SIDE )
+                && ( port->attr_mode != PORT_MODE_BI ) )
+            igraph_vector_ptr_push_back( &rn_ports,
+                    install_nets_farm_rn( ports, width, g, farm, tc ) );
+        for( replica = 0; replica < width; replica++ )
+            if( ports[replica] != NULL )
+                ports[replica] = ports[replica]->next;
+    }
+    free( ports );
+
+    // the side ports of the replicas are connected by copy synchronizers
+    v_net = v_nets[0];
+    for( replica = 1; replica < width; replica++ )
+        v_net = install_nets_parallel( v_net, v_nets[replica], g,
+                AST_PARALLEL, tc );
+    for( i = 0; i < igraph_vector_ptr_size( &rn_ports ); i++ )
+        virt_port_append( v_net, VECTOR( rn_ports )[i] );
+    igraph_vector_ptr_destroy( &rn_ports );
+    free( v_nets );
+    return v_net;
+}
+
+/******************************************************************************/
+virt_port_t* install_nets_farm_rn( virt_port_list_t** ports, int width,
+        igraph_t* g, int farm, time_criticality_t tc )
+{
+    struct timespec tb;
+    virt_net_t* v_net_rn;
+    virt_port_t* port = ports[0]->port;
+    virt_port_t* port_rn;
+    bool is_dispatch = ( port->attr_mode == PORT_MODE_IN );
+    int replica;
+
+    tb.tv_sec = 0;
+    tb.tv_nsec = 0;
+    v_net_rn = dgraph_vertex_add_sync( g,
+            is_dispatch ? TEXT_FARM_DISPATCH : TEXT_FARM_COLLECT );
+    dgraph_vertex_add_attr_tt( g, v_net_rn->inst->id,
+            get_time_criticality_prio( tc, false ) );
+    igraph_cattribute_VAN_set( g, GV_FARM_RN, v_net_rn->inst->id,
+            is_dispatch ? FARM_RN_DISPATCH : FARM_RN_COLLECT );
+    igraph_cattribute_VAN_set( g, GV_FARM, v_net_rn->inst->id, farm );
+    igraph_cattribute_VAN_set( g, GV_REPLICA, v_net_rn->inst->id, 0 );
+    // as with copy synchronizers the channel length is set by the replicas
+    port_rn = virt_port_create( port->attr_class, port->attr_mode, v_net_rn,
+            port->name, port->symb, tb, TIME_NONE, false, port->is_open,
+            false, 0, port->msg_size );
+    virt_port_append( v_net_rn, port_rn );
+    for( replica = 0; replica < width; replica++ ) {
+        if( ( ports[replica] == NULL )
+                || ( ports[replica]->port->symb != port->symb ) )
+            continue;
+        connect_ports( ports[replica]->port, port_rn, g, false );
+        ports[replica]->port->state = VPORT_STATE_CONNECTED;
+    }
+    return port_rn;
+}
+
+/******************************************************************************/
+virt_net_t* install_nets_parallel( virt_net_t* v_net1, virt_net_t* v_net2,
+        igraph_t* g, node_type_t type, time_criticality_t tc )
+{
+    virt_net_t* v_net = NULL;
+
+    v_net = virt_net_create_parallel( v_net1, v_net2 );
+    virt_net_destroy_shallow( v_net1 );
+    virt_net_destroy_shallow( v_net2 );
+    check_connections_cp( v_net, g, type, tc );
+    return v_net;
+}
+
+/******************************************************************************/
+virt_net_t* install_nets_serial( virt_net_t* v_net1, virt_net_t* v_net2,
+        igraph_t* g, node_type_t type, time_criticality_t tc )
+{
+    virt_net_t* v_net = NULL;
+
+    // check connections and update virtual net
+    check_connections( v_net1, v_net2, g );
+    post_process_merge_new( g );
+    /* force = ( type == AST_SERIAL); */
+    if( type == AST_SERIAL ) {
+        virt_net_update_class( v_net1, PORT_CLASS_UP );
+        virt_net_update_class( v_net2, PORT_CLASS_DOWN );
+        check_connections_open( v_net1, v_net2 );
+    }
+    check_connection_missing( v_net1, v_net2, g, type == AST_SERIAL_PROP );
+    v_net = virt_net_create_serial( v_net1, v_net2 );
+    virt_net_destroy_shallow( v_net1 );
+    virt_net_destroy_shallow( v_net2 );
+    check_connections_cp( v_net, g, AST_SERIAL, tc );
+    return v_net;
+}
+
 /******************************************************************************/
 void post_process( igraph_t* g )
 {
     igraph_vs_t vs;
-    igraph_es_t es;
     igraph_vit_t vit;
-    igraph_eit_t eit;
     igraph_vector_t dids;
     virt_net_t *v_net;
-    int inst_id, eid;
-    bool has_changed = true;
-    bool is_decoupled = false;
+    int inst_id;
 
     post_process_merge( g );
 
@@ -1242,7 +1596,9 @@ void post_process( igraph_t* g )
             check_ports_open( v_net );
         }
         else if( v_net->type == VNET_SYNC ) {
-            if( check_single_mode_cp( g, inst_id ) )
+            // the routing nodes of farms are kept for the runtime
+            if( check_single_mode_cp( g, inst_id )
+                    && !dgraph_vertex_is_farm_rn( g, inst_id ) )
             {
                 if( cpsync_reduce( g, inst_id ) ) {
                     igraph_vector_push_back( &dids, inst_id );
@@ -1262,97 +1618,238 @@ void post_process( igraph_t* g )
     // the port attributes in the corresponding vnets. This results from the
     // same sloppyness as described above but works because vnets are no longer
     // used afterwards.
-    has_changed = true;
-    while( has_changed )
-    {
-        vs = igraph_vss_all();
-        igraph_vit_create( g, vs, &vit );
-        has_changed = false;
-        while( !IGRAPH_VIT_END( vit ) ) {
-            inst_id = IGRAPH_VIT_GET( vit );
-            v_net = ( virt_net_t* )( uintptr_t )igraph_cattribute_VAN( g,
-                    GV_VNET, inst_id );
-            if( v_net->type == VNET_SYNC ) {
-                is_decoupled = false;
-                igraph_es_incident( &es, inst_id, IGRAPH_IN );
-                igraph_eit_create( g, es, &eit );
-                while( !IGRAPH_EIT_END( eit ) ) {
-                    eid = IGRAPH_EIT_GET( eit );
-                    if( igraph_cattribute_EAN( g, GE_DSRC, eid ) )
-                    {
-                        is_decoupled = true;
-                        has_changed = true;
-                        igraph_cattribute_EAN_set( g, GE_DSRC, eid, false );
-                    }
-                    IGRAPH_EIT_NEXT( eit );
-                }
-                igraph_eit_destroy( &eit );
-                igraph_es_destroy( &es );
-                if( is_decoupled )
-                {
-                    igraph_es_incident( &es, inst_id, IGRAPH_OUT );
-                    igraph_eit_create( g, es, &eit );
-                    while( !IGRAPH_EIT_END( eit ) ) {
-                        eid = IGRAPH_EIT_GET( eit );
-                        igraph_cattribute_EAN_set( g, GE_DSRC, eid, true );
-                        IGRAPH_EIT_NEXT( eit );
-                    }
-                    igraph_eit_destroy( &eit );
-                    igraph_es_destroy( &es );
-                }
+    post_process_decoupling( g );
+
+    // mark the channels between the routing nodes and the replicas of farms
+    post_process_farm( g );
+
+    // propagate the declared message sizes through the routing nodes
+    post_process_msg_size( g );
+    check_msg_size_cp( g );
+}
+
+/******************************************************************************/
+void post_process_decoupling( igraph_t* g )
+{
+    igraph_es_t es;
+    igraph_eit_t eit;
+    virt_net_t *v_net;
+    int inst_id, eid, id_src, id_dst;
+    int v_count = igraph_vcount( g );
+    int* stack = malloc( sizeof( int ) * ( v_count + 1 ) );
+    bool* is_sync = malloc( sizeof( bool ) * ( v_count + 1 ) );
+    bool* is_reached = malloc( sizeof( bool ) * ( v_count + 1 ) );
+    int top = 0;
+
+    for( inst_id = 0; inst_id < v_count; inst_id++ ) {
+        v_net = ( virt_net_t* )( uintptr_t )igraph_cattribute_VAN( g,
+                GV_VNET, inst_id );
+        is_sync[inst_id] = ( v_net->type == VNET_SYNC );
+        is_reached[inst_id] = false;
+    }
+
+    // a routing node is reached by the decoupling if one of its input
+    // channels is decoupled. The decoupling is removed from the input channels
+    // of routing nodes.
+    es = igraph_ess_all( IGRAPH_EDGEORDER_ID );
+    igraph_eit_create( g, es, &eit );
+    while( !IGRAPH_EIT_END( eit ) ) {
+        eid = IGRAPH_EIT_GET( eit );
+        igraph_edge( g, eid, &id_src, &id_dst );
+        if( is_sync[id_dst] && igraph_cattribute_EAN( g, GE_DSRC, eid ) ) {
+            igraph_cattribute_EAN_set( g, GE_DSRC, eid, false );
+            if( !is_reached[id_dst] ) {
+                is_reached[id_dst] = true;
+                stack[top++] = id_dst;
+            }
+        }
+        IGRAPH_EIT_NEXT( eit );
+    }
+    igraph_eit_destroy( &eit );
+    igraph_es_destroy( &es );
+
+    // each reached routing node passes the decoupling on to all its output
+    // channels: channels to other routing nodes forward the decoupling to the
+    // next routing node, channels to boxes become decoupled. Each routing node
+    // is visited at most once.
+    while( top > 0 ) {
+        inst_id = stack[--top];
+        igraph_es_incident( &es, inst_id, IGRAPH_OUT );
+        igraph_eit_create( g, es, &eit );
+        while( !IGRAPH_EIT_END( eit ) ) {
+            eid = IGRAPH_EIT_GET( eit );
+            igraph_edge( g, eid, &id_src, &id_dst );
+            if( !is_sync[id_dst] )
+                igraph_cattribute_EAN_set( g, GE_DSRC, eid, true );
+            else if( !is_reached[id_dst] ) {
+                is_reached[id_dst] = true;
+                stack[top++] = id_dst;
             }
-            IGRAPH_VIT_NEXT( vit );
+            IGRAPH_EIT_NEXT( eit );
         }
-        igraph_vit_destroy( &vit );
-        igraph_vs_destroy( &vs );
+        igraph_eit_destroy( &eit );
+        igraph_es_destroy( &es );
     }
 
+    free( stack );
+    free( is_sync );
+    free( is_reached );
+}
+
+/******************************************************************************/
+void post_process_farm( igraph_t* g )
+{
+    int vid, eid, id_src, id_dst, id_rn, id_rep, farm;
+    int farm_cnt = 0;
+
+    if( !igraph_cattribute_has_attr( g, IGRAPH_ATTRIBUTE_VERTEX, GV_FARM ) )
+        return;
+
+    // the farms are numbered in the order of the vertices
+    dgraph_vertex_update_farms( g, &farm_cnt );
+
+    for( eid = 0; eid < igraph_ecount( g ); eid++ ) {
+        igraph_edge( g, eid, &id_src, &id_dst );
+        igraph_cattribute_EAN_set( g, GE_FARM, eid, 0 );
+        igraph_cattribute_EAN_set( g, GE_REPLICA, eid, 0 );
+        if( dgraph_vertex_get_farm( g, id_src, GV_FARM_RN )
+                == FARM_RN_DISPATCH ) {
+            id_rn = id_src;
+            id_rep = id_dst;
+        }
+        else if( dgraph_vertex_get_farm( g, id_dst, GV_FARM_RN )
+                == FARM_RN_COLLECT ) {
+            id_rn = id_dst;
+            id_rep = id_src;
+        }
+        else continue;
+        // the replica is a vertex of the farm or a nested farm
+        farm = dgraph_vertex_get_farm( g, id_rn, GV_FARM );
+        igraph_cattribute_EAN_set( g, GE_FARM, eid, farm );
+        if( dgraph_vertex_get_farm( g, id_rep, GV_FARM ) == farm )
+            igraph_cattribute_EAN_set( g, GE_REPLICA, eid,
+                    dgraph_vertex_get_farm( g, id_rep, GV_REPLICA ) );
+        else
+            igraph_cattribute_EAN_set( g, GE_REPLICA, eid,
+                    dgraph_vertex_get_farm( g, id_rep, GV_REPLICA_OUTER ) );
+    }
+
+    for( vid = 0; vid < igraph_vcount( g ); vid++ )
+        dgraph_vertex_init_farm( g, vid );
 }
 
 /******************************************************************************/
 void post_process_merge( igraph_t* g )
 {
-    igraph_es_t es;
-    igraph_es_t esd;
-    igraph_eit_t eit;
     int eid;
-    virt_port_t *p_src, *p_dest;
     bool has_changed = true;
 
     while( has_changed )
     {
         has_changed = false;
-        es = igraph_ess_all( IGRAPH_EDGEORDER_ID );
-        igraph_eit_create( g, es, &eit );
         // iterate through all edges of the graph
-        while( !IGRAPH_EIT_END( eit ) ) {
-            p_src = ( virt_port_t* )( uintptr_t ) igraph_cattribute_EAN( g,
-                    GE_PSRC, IGRAPH_EIT_GET( eit ) );
-            p_dest = ( virt_port_t* )( uintptr_t ) igraph_cattribute_EAN( g,
-                    GE_PDST, IGRAPH_EIT_GET( eit ) );
-            if( ( p_src ->v_net->type == VNET_SYNC )
-                    && ( p_dest->v_net->type == VNET_SYNC ) )
-            {
-                if( check_cpsync_merge_post_connect( g, IGRAPH_VIT_GET( eit ) ) )
-                {
-                    propagate_decoupling_attributes( g, p_src, p_dest );
-                    cpsync_merge( p_src, p_dest, g );
-                    has_changed = true;
-                    eid = IGRAPH_VIT_GET( eit );
-                    break;
-                }
+        for( eid = 0; eid < igraph_ecount( g ); eid++ ) {
+            if( post_process_merge_edge( g, eid ) ) {
+                has_changed = true;
+                break;
             }
-            IGRAPH_EIT_NEXT( eit );
         }
-        igraph_eit_destroy( &eit );
-        igraph_es_destroy( &es );
-        if( has_changed )
-        {
-            esd = igraph_ess_1( eid );
-            igraph_delete_edges( g, esd );
-            igraph_es_destroy( &esd );
+    }
+}
+
+/******************************************************************************/
+bool post_process_merge_edge( igraph_t* g, int eid )
+{
+    igraph_es_t esd;
+    virt_port_t *p_src, *p_dest;
+
+    p_src = ( virt_port_t* )( uintptr_t ) igraph_cattribute_EAN( g, GE_PSRC,
+            eid );
+    p_dest = ( virt_port_t* )( uintptr_t ) igraph_cattribute_EAN( g, GE_PDST,
+            eid );
+    if( ( p_src->v_net->type != VNET_SYNC )
+            || ( p_dest->v_net->type != VNET_SYNC )
+            || dgraph_vertex_is_farm_rn( g, p_src->v_net->inst->id )
+            || dgraph_vertex_is_farm_rn( g, p_dest->v_net->inst->id )
+            || !check_cpsync_merge_post_connect( g, eid ) )
+        return false;
+
+    propagate_decoupling_attributes( g, p_src, p_dest );
+    cpsync_merge( p_src, p_dest, g );
+    esd = igraph_ess_1( eid );
+    igraph_delete_edges( g, esd );
+    igraph_es_destroy( &esd );
+    return true;
+}
+
+/******************************************************************************/
+void post_process_merge_new( igraph_t* g )
+{
+    int eid = 0;
+
+    // the channels checked by the last pass can only become mergeable if the
+    // degree of a routing node drops, which clears the mark
+    if( igraph_cattribute_has_attr( g, IGRAPH_ATTRIBUTE_GRAPH, GG_MERGE_ECNT ) )
+        eid = igraph_cattribute_GAN( g, GG_MERGE_ECNT );
+    for( ; eid < igraph_ecount( g ); eid++ ) {
+        if( post_process_merge_edge( g, eid ) ) {
+            // a merge changes the degrees, continue as before
+            post_process_merge( g );
+            break;
         }
     }
+    igraph_cattribute_GAN_set( g, GG_MERGE_ECNT, igraph_ecount( g ) );
+}
+
+/******************************************************************************/
+void post_process_msg_size( igraph_t* g )
+{
+    int eid, i, j, size, head = 0, tail = 0;
+    int vids[2];
+    int* queue;
+    igraph_integer_t id_src, id_dst;
+    igraph_vector_t eids;
+    virt_net_t* v_net;
+
+    if( !igraph_cattribute_has_attr( g, IGRAPH_ATTRIBUTE_EDGE, GE_MSG_SIZE ) )
+        return;
+
+    // channels without a declared message size hold NaN, the others seed the
+    // propagation
+    queue = malloc( sizeof( int ) * ( igraph_ecount( g ) + 1 ) );
+    for( eid = 0; eid < igraph_ecount( g ); eid++ ) {
+        if( isnan( igraph_cattribute_EAN( g, GE_MSG_SIZE, eid ) ) )
+            igraph_cattribute_EAN_set( g, GE_MSG_SIZE, eid, 0 );
+        else if( igraph_cattribute_EAN( g, GE_MSG_SIZE, eid ) > 0 )
+            queue[tail++] = eid;
+    }
+
+    // a routing node copies the messages, hence all its channels carry the
+    // same message size. Each channel is queued once, when its size is known.
+    igraph_vector_init( &eids, 0 );
+    while( head < tail ) {
+        eid = queue[head++];
+        size = igraph_cattribute_EAN( g, GE_MSG_SIZE, eid );
+        igraph_edge( g, eid, &id_src, &id_dst );
+        vids[0] = id_src;
+        vids[1] = id_dst;
+        for( j = 0; j < 2; j++ ) {
+            v_net = ( virt_net_t* )( uintptr_t )igraph_cattribute_VAN( g,
+                    GV_VNET, vids[j] );
+            if( v_net->type != VNET_SYNC ) continue;
+            igraph_incident( g, &eids, vids[j], IGRAPH_ALL );
+            for( i = 0; i < igraph_vector_size( &eids ); i++ ) {
+                if( igraph_cattribute_EAN( g, GE_MSG_SIZE,
+                            VECTOR( eids )[i] ) > 0 )
+                    continue;
+                igraph_cattribute_EAN_set( g, GE_MSG_SIZE, VECTOR( eids )[i],
+                        size );
+                queue[tail++] = VECTOR( eids )[i];
+            }
+        }
+    }
+    free( queue );
+    igraph_vector_destroy( &eids );
 }
 
 /******************************************************************************/
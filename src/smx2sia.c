@@ -68,6 +68,116 @@ void smx2sia_add_transition( igraph_t* g, virt_port_t* port, int id_src,
     free( edge_id );
 }
 
+/******************************************************************************/
+int smx2sia_archive_cmp( const void* a, const void* b )
+{
+    return strcmp( ( *( sia_t* const* )a )->smx_name,
+            ( *( sia_t* const* )b )->smx_name );
+}
+
+/******************************************************************************/
+int smx2sia_archive_write( sia_t** symbols, const char* path,
+        const char* format, bool compress )
+{
+    FILE* out_file;
+    FILE* mem_file;
+    sia_t* sia;
+    sia_t* tmp;
+    sia_t** sorted;
+    char* buf;
+    size_t buf_len;
+    long* offsets;
+    long* sizes;
+    long pos;
+    int count = HASH_CNT( hh_smx, *symbols );
+    int name_len = 0;
+    int entry_len;
+    int i;
+    bool is_ok = true;
+
+    // the table of contents is sorted by name to allow a bisection search
+    sorted = malloc( sizeof( sia_t* ) * ( count + 1 ) );
+    offsets = malloc( sizeof( long ) * ( count + 1 ) );
+    sizes = malloc( sizeof( long ) * ( count + 1 ) );
+    if( sorted == NULL || offsets == NULL || sizes == NULL ) {
+        printf( "Cannot allocate the table of contents of '%s'!\n", path );
+        free( sorted );
+        free( offsets );
+        free( sizes );
+        return -1;
+    }
+    i = 0;
+    HASH_ITER( hh_smx, *symbols, sia, tmp ) {
+        sorted[i++] = sia;
+        if( ( int )strlen( sia->smx_name ) > name_len )
+            name_len = strlen( sia->smx_name );
+    }
+    qsort( sorted, count, sizeof( sia_t* ), smx2sia_archive_cmp );
+    entry_len = 2 * ( SIA_ARCHIVE_NUM_LEN + 1 ) + name_len + 1;
+
+    out_file = fopen( path, "w" );
+    if( out_file == NULL ) {
+        printf( "Cannot open file '%s'!\n", path );
+        free( sorted );
+        free( offsets );
+        free( sizes );
+        return -1;
+    }
+    // reserve the space of the table of contents which has a fixed size
+    pos = fprintf( out_file, "%s %d %d %s %s %d\n", SIA_ARCHIVE_MAGIC,
+            SIA_ARCHIVE_VERSION, count, format,
+            compress ? SIA_ARCHIVE_GZ : SIA_ARCHIVE_RAW, entry_len );
+    pos += ( long )count * entry_len;
+    fseek( out_file, pos, SEEK_SET );
+
+    for( i = 0; i < count; i++ ) {
+        sia = sorted[i];
+        offsets[i] = ftell( out_file );
+        if( compress ) {
+            mem_file = open_memstream( &buf, &buf_len );
+            if( mem_file == NULL ) {
+                is_ok = false;
+                break;
+            }
+            if( strcmp( format, G_FMT_GML ) == 0 )
+                igraph_write_graph_gml( &sia->g, mem_file, NULL, G_GML_HEAD );
+            else
+                igraph_write_graph_graphml( &sia->g, mem_file, 0 );
+            fclose( mem_file );
+            is_ok = ( smxz_deflate( out_file, buf, buf_len ) >= 0 );
+            free( buf );
+            if( !is_ok ) break;
+        }
+        else if( strcmp( format, G_FMT_GML ) == 0 )
+            igraph_write_graph_gml( &sia->g, out_file, NULL, G_GML_HEAD );
+        else
+            igraph_write_graph_graphml( &sia->g, out_file, 0 );
+        sizes[i] = ftell( out_file ) - offsets[i];
+    }
+    if( !is_ok ) {
+        printf( "Cannot compress the SIAs of '%s'!\n", path );
+        free( sorted );
+        free( offsets );
+        free( sizes );
+        fclose( out_file );
+        return -1;
+    }
+
+    // fill in the table of contents, the names are padded to a fixed width
+    fseek( out_file, 0, SEEK_SET );
+    fprintf( out_file, "%s %d %d %s %s %d\n", SIA_ARCHIVE_MAGIC,
+            SIA_ARCHIVE_VERSION, count, format,
+            compress ? SIA_ARCHIVE_GZ : SIA_ARCHIVE_RAW, entry_len );
+    for( i = 0; i < count; i++ )
+        fprintf( out_file, "%0*ld %0*ld %-*s\n", SIA_ARCHIVE_NUM_LEN,
+                offsets[i], SIA_ARCHIVE_NUM_LEN, sizes[i], name_len,
+                sorted[i]->smx_name );
+    free( sorted );
+    free( offsets );
+    free( sizes );
+    return ( fclose( out_file ) == 0 ) ? count : -1;
+}
+
 /******************************************************************************/
 void smx2sia_set_name_box( sia_t* sia, const char* box_name,
         const char* impl_name, int id )
@@ -144,13 +254,22 @@ void smx2sia_sias_destroy( sias_t* sias, sia_t** desc_symbols,
 
 /******************************************************************************/
 void smx2sia_sias_write( sia_t** symbols, const char* out_path,
-        const char* format )
+        const char* format, bool compress )
 {
     sia_t* sia;
     sia_t* tmp;
+    char* path;
 
     HASH_ITER( hh_smx, *symbols, sia, tmp ) {
-        sia_write( sia, sia->smx_name, out_path, format );
+        if( compress ) {
+            path = malloc( strlen( out_path ) + strlen( sia->smx_name )
+                    + strlen( format ) + strlen( SMXZ_SUFFIX ) + 3 );
+            sprintf( path, "%s/%s.%s%s", out_path, sia->smx_name, format,
+                    SMXZ_SUFFIX );
+            smxz_write_graph( &sia->g, path, format );
+            free( path );
+        }
+        else sia_write( sia, sia->smx_name, out_path, format );
     }
 }
 
@@ -161,10 +280,24 @@ void smx2sia_update( igraph_t* g, virt_port_list_t* ports_rec, int vid )
     igraph_es_t es;
     igraph_eit_t eit;
     const char* name;
-    char* edge_id;
     char error_msg[ CONST_ERROR_LEN ];
     virt_port_list_t* ports;
-    bool match;
+    smx2sia_port_t* port_hash = NULL;
+    smx2sia_port_t* port;
+    smx2sia_port_t* tmp;
+
+    // hash the signature and create the action names only once
+    for( ports = ports_rec; ports != NULL; ports = ports->next ) {
+        HASH_FIND_STR( port_hash, ports->port->name, port );
+        if( port == NULL ) {
+            port = malloc( sizeof( smx2sia_port_t ) );
+            port->name = ports->port->name;
+            HASH_ADD_KEYPTR( hh, port_hash, port->name, strlen( port->name ),
+                    port );
+        }
+        else free( port->action ); // the last port with this name is bound
+        port->action = sia_create_action_name( vid, ports->port->edge_id );
+    }
 
     es = igraph_ess_all( IGRAPH_EDGEORDER_ID );
     igraph_eit_create( g, es, &eit );
@@ -174,19 +307,12 @@ void smx2sia_update( igraph_t* g, virt_port_list_t* ports_rec, int vid )
     while( !IGRAPH_EIT_END( eit ) ) {
         eid = IGRAPH_EIT_GET( eit );
         name = igraph_cattribute_EAS( g, G_SIA_PNAME, eid );
-        match = false;
-        ports = ports_rec;
         // search for a matching port in the signature
-        while( ports != NULL ) {
-            if( strcmp( name, ports->port->name ) == 0 ) {
-                edge_id = sia_create_action_name( vid, ports->port->edge_id );
-                igraph_cattribute_EAS_set( g, G_SIA_NAME, eid, edge_id );
-                free( edge_id );
-                match = true;
-            }
-            ports = ports->next;
+        HASH_FIND_STR( port_hash, name, port );
+        if( port != NULL ) {
+            igraph_cattribute_EAS_set( g, G_SIA_NAME, eid, port->action );
         }
-        if( !match ) {
+        else {
             sprintf( error_msg, ERROR_BAD_SIA_PORT, ERR_ERROR, name );
             report_yyerror( error_msg, 0 );
         }
@@ -194,4 +320,10 @@ void smx2sia_update( igraph_t* g, virt_port_list_t* ports_rec, int vid )
     }
     igraph_eit_destroy( &eit );
     igraph_es_destroy( &es );
+
+    HASH_ITER( hh, port_hash, port, tmp ) {
+        HASH_DEL( port_hash, port );
+        free( port->action );
+        free( port );
+    }
 }
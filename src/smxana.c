@@ -0,0 +1,844 @@
+/**
+ * Analysis passes on the flattened dependency graph
+ *
+ * @file    smxana.c
+ * @author  Simon Maurer
+ *
+ */
+
+#include <inttypes.h>
+#include "smxana.h"
+#include "defines.h"
+
+/******************************************************************************/
+int smxana_channel_box_cnt( igraph_t* g, int vid, igraph_neimode_t mode,
+        int* mark, int stamp )
+{
+    int id, idx;
+    int cnt = 0;
+    int sp = 0;
+    int* stack;
+    virt_net_t* v_net;
+    igraph_vector_t nbrs;
+
+    v_net = ( virt_net_t* )( uintptr_t )igraph_cattribute_VAN( g, GV_VNET,
+            vid );
+    if( v_net->type != VNET_SYNC )
+        return 1;
+
+    stack = malloc( sizeof( int ) * ( igraph_vcount( g ) + 1 ) );
+    igraph_vector_init( &nbrs, 0 );
+    mark[vid] = stamp;
+    stack[sp++] = vid;
+    // walk through the adjacent routing nodes and count the boxes at the end
+    while( sp > 0 ) {
+        igraph_neighbors( g, &nbrs, stack[--sp], mode );
+        for( idx = 0; idx < igraph_vector_size( &nbrs ); idx++ ) {
+            id = VECTOR( nbrs )[idx];
+            if( mark[id] == stamp ) continue;
+            mark[id] = stamp;
+            v_net = ( virt_net_t* )( uintptr_t )igraph_cattribute_VAN( g,
+                    GV_VNET, id );
+            if( v_net->type == VNET_SYNC )
+                stack[sp++] = id;
+            else
+                cnt++;
+        }
+    }
+    igraph_vector_destroy( &nbrs );
+    free( stack );
+    return cnt;
+}
+
+/******************************************************************************/
+void smxana_channel_class( igraph_t* g )
+{
+    int vid, eid;
+    int stamp = 0;
+    int v_count = igraph_vcount( g );
+    int e_count = igraph_ecount( g );
+    int* mark = calloc( v_count + 1, sizeof( int ) );
+    bool is_decoupled;
+
+    for( vid = 0; vid < v_count; vid++ ) {
+        igraph_cattribute_VAN_set( g, GV_FANIN, vid,
+                smxana_channel_box_cnt( g, vid, IGRAPH_IN, mark, ++stamp ) );
+        igraph_cattribute_VAN_set( g, GV_FANOUT, vid,
+                smxana_channel_box_cnt( g, vid, IGRAPH_OUT, mark, ++stamp ) );
+    }
+    // each end of a channel is one vertex, a fan-in or a fan-out of boxes is
+    // a routing node which runs on its own
+    for( eid = 0; eid < e_count; eid++ ) {
+        is_decoupled = igraph_cattribute_EAN( g, GE_DSRC, eid )
+            || igraph_cattribute_EAN( g, GE_DDST, eid );
+        igraph_cattribute_EAN_set( g, GE_CLASS, eid, CHANNEL_CLASS_SPSC );
+        igraph_cattribute_EAN_set( g, GE_DEC, eid, is_decoupled );
+    }
+    free( mark );
+}
+
+/******************************************************************************/
+void smxana_json_write_str( FILE* out, const char* str )
+{
+    fputc( '"', out );
+    for( ; str != NULL && *str != '\0'; str++ ) {
+        if( *str == '"' || *str == '\\' )
+            fprintf( out, "\\%c", *str );
+        else if( ( unsigned char )*str < 0x20 )
+            fprintf( out, "\\u%04x", ( unsigned char )*str );
+        else
+            fputc( *str, out );
+    }
+    fputc( '"', out );
+}
+
+/******************************************************************************/
+void smxana_latency( igraph_t* g, wcet_t* wcets, latency_t* lat )
+{
+    int vid, eid, id_src, id_dst, idx, len;
+    int q_head = 0, q_tail = 0;
+    int* indeg;
+    int* queue;
+    uint64_t period, dist;
+    virt_net_t* v_net;
+    igraph_es_t es;
+    igraph_eit_t eit;
+
+    lat->v_count = igraph_vcount( g );
+    lat->e_count = igraph_ecount( g );
+    lat->out_idx = calloc( lat->v_count + 1, sizeof( int ) );
+    lat->out_eids = malloc( sizeof( int ) * ( lat->e_count + 1 ) );
+    lat->cost = calloc( lat->v_count + 1, sizeof( uint64_t ) );
+    lat->dist = calloc( lat->v_count + 1, sizeof( uint64_t ) );
+    lat->period = calloc( lat->v_count + 1, sizeof( uint64_t ) );
+    lat->span = calloc( lat->v_count + 1, sizeof( uint64_t ) );
+    lat->pred = malloc( sizeof( int ) * ( lat->v_count + 1 ) );
+    lat->source = malloc( sizeof( int ) * ( lat->v_count + 1 ) );
+    lat->has_wcet = calloc( lat->v_count + 1, sizeof( bool ) );
+    lat->delay = calloc( lat->e_count + 1, sizeof( uint64_t ) );
+    lat->is_feedback = calloc( lat->e_count + 1, sizeof( bool ) );
+    lat->feedback_cnt = 0;
+    lat->missing_cnt = 0;
+    lat->critical = -1;
+    indeg = calloc( lat->v_count + 1, sizeof( int ) );
+    queue = malloc( sizeof( int ) * ( lat->v_count + 1 ) );
+
+    // group the out-edges by source vertex
+    for( eid = 0; eid < lat->e_count; eid++ ) {
+        igraph_edge( g, eid, &id_src, &id_dst );
+        lat->out_idx[id_src + 1]++;
+    }
+    for( vid = 0; vid < lat->v_count; vid++ )
+        lat->out_idx[vid + 1] += lat->out_idx[vid];
+    for( vid = 0; vid < lat->v_count; vid++ )
+        queue[vid] = lat->out_idx[vid];
+    for( eid = 0; eid < lat->e_count; eid++ ) {
+        igraph_edge( g, eid, &id_src, &id_dst );
+        lat->out_eids[ queue[id_src]++ ] = eid;
+    }
+
+    // execution cost and period of each vertex
+    for( vid = 0; vid < lat->v_count; vid++ ) {
+        v_net = ( virt_net_t* )( uintptr_t )igraph_cattribute_VAN( g,
+                GV_VNET, vid );
+        lat->pred[vid] = -1;
+        lat->source[vid] = vid;
+        lat->period[vid] = smxana_vertex_period( g, vid );
+        if( v_net->type != VNET_BOX ) continue;
+        lat->has_wcet[vid] = smxana_wcet_get( wcets,
+                igraph_cattribute_VAS( g, GV_IMPL, vid ),
+                igraph_cattribute_VAS( g, GV_LABEL, vid ), &lat->cost[vid] );
+        if( !lat->has_wcet[vid] ) lat->missing_cnt++;
+    }
+
+    smxana_latency_feedback( g, lat );
+
+    // queueing delay of each channel
+    es = igraph_ess_all( IGRAPH_EDGEORDER_ID );
+    igraph_eit_create( g, es, &eit );
+    while( !IGRAPH_EIT_END( eit ) ) {
+        eid = IGRAPH_EIT_GET( eit );
+        igraph_edge( g, eid, &id_src, &id_dst );
+        len = igraph_cattribute_EAN( g, GE_LEN, eid );
+        if( igraph_cattribute_EAN( g, GE_DSRC, eid )
+                || igraph_cattribute_EAN( g, GE_DDST, eid ) || len < 1 )
+            len = 1;
+        period = ( uint64_t )igraph_cattribute_EAN( g, GE_DTS, eid )
+            * 1000000000 + igraph_cattribute_EAN( g, GE_DTNS, eid );
+        // the boxes of a tt net run within the same period
+        if( smxana_latency_is_tt_inner( g, eid ) )
+            lat->delay[eid] = 0;
+        else if( igraph_cattribute_EAN( g, GE_TYPE, eid ) != TIME_NONE
+                && period > 0 )
+            lat->delay[eid] = len * period;
+        else
+            lat->delay[eid] = ( len - 1 ) * lat->cost[id_dst];
+        if( !lat->is_feedback[eid] ) indeg[id_dst]++;
+        IGRAPH_EIT_NEXT( eit );
+    }
+    igraph_eit_destroy( &eit );
+    igraph_es_destroy( &es );
+
+    // longest path in topological order
+    for( vid = 0; vid < lat->v_count; vid++ ) {
+        lat->dist[vid] = lat->cost[vid];
+        if( indeg[vid] == 0 ) queue[q_tail++] = vid;
+    }
+    while( q_head < q_tail ) {
+        vid = queue[q_head++];
+        for( idx = lat->out_idx[vid]; idx < lat->out_idx[vid + 1]; idx++ ) {
+            eid = lat->out_eids[idx];
+            if( lat->is_feedback[eid] ) continue;
+            igraph_edge( g, eid, &id_src, &id_dst );
+            dist = lat->dist[vid] + lat->delay[eid] + lat->cost[id_dst];
+            if( lat->pred[id_dst] < 0 || dist > lat->dist[id_dst] ) {
+                lat->dist[id_dst] = dist;
+                lat->pred[id_dst] = eid;
+                lat->source[id_dst] = lat->source[vid];
+            }
+            indeg[id_dst]--;
+            if( indeg[id_dst] == 0 ) queue[q_tail++] = id_dst;
+        }
+    }
+
+    // cost of the tt paths, walk the vertices in reverse topological order and
+    // follow the channels inside tt nets, i.e. timed at both ends
+    while( q_tail > 0 ) {
+        vid = queue[--q_tail];
+        lat->span[vid] = lat->cost[vid];
+        for( idx = lat->out_idx[vid]; idx < lat->out_idx[vid + 1]; idx++ ) {
+            eid = lat->out_eids[idx];
+            if( lat->is_feedback[eid] || !smxana_latency_is_tt_inner( g, eid ) )
+                continue;
+            igraph_edge( g, eid, &id_src, &id_dst );
+            if( lat->cost[vid] + lat->span[id_dst] > lat->span[vid] )
+                lat->span[vid] = lat->cost[vid] + lat->span[id_dst];
+            indeg[id_dst] = -1;
+        }
+    }
+    // only the first vertex of a tt path is checked, indeg is 0 for all
+    // vertices after the topological walk and marks the inner vertices above
+    for( vid = 0; vid < lat->v_count; vid++ )
+        if( indeg[vid] < 0 ) lat->span[vid] = 0;
+
+    // the critical path ends in the sink with the highest latency
+    for( vid = 0; vid < lat->v_count; vid++ ) {
+        if( !smxana_latency_is_sink( lat, vid ) ) continue;
+        if( lat->critical < 0 || lat->dist[vid] > lat->dist[lat->critical] )
+            lat->critical = vid;
+    }
+
+    free( indeg );
+    free( queue );
+}
+
+/******************************************************************************/
+void smxana_latency_destroy( latency_t* lat )
+{
+    free( lat->out_idx );
+    free( lat->out_eids );
+    free( lat->cost );
+    free( lat->delay );
+    free( lat->dist );
+    free( lat->period );
+    free( lat->span );
+    free( lat->pred );
+    free( lat->source );
+    free( lat->is_feedback );
+    free( lat->has_wcet );
+}
+
+/******************************************************************************/
+void smxana_latency_feedback( igraph_t* g, latency_t* lat )
+{
+    int vid, eid, id_src, id_dst, id;
+    int sp = 0;
+    int* color = calloc( lat->v_count + 1, sizeof( int ) );
+    int* next = malloc( sizeof( int ) * ( lat->v_count + 1 ) );
+    int* stack = malloc( sizeof( int ) * ( lat->v_count + 1 ) );
+
+    // 0: not visited, 1: on the search path, 2: done
+    for( vid = 0; vid < lat->v_count; vid++ ) {
+        if( color[vid] != 0 ) continue;
+        color[vid] = 1;
+        next[vid] = lat->out_idx[vid];
+        stack[sp++] = vid;
+        while( sp > 0 ) {
+            id = stack[sp - 1];
+            if( next[id] < lat->out_idx[id + 1] ) {
+                eid = lat->out_eids[ next[id]++ ];
+                igraph_edge( g, eid, &id_src, &id_dst );
+                if( color[id_dst] == 1 ) {
+                    lat->is_feedback[eid] = true;
+                    lat->feedback_cnt++;
+                }
+                else if( color[id_dst] == 0 ) {
+                    color[id_dst] = 1;
+                    next[id_dst] = lat->out_idx[id_dst];
+                    stack[sp++] = id_dst;
+                }
+            }
+            else {
+                color[id] = 2;
+                sp--;
+            }
+        }
+    }
+
+    free( color );
+    free( next );
+    free( stack );
+}
+
+/******************************************************************************/
+bool smxana_latency_is_sink( latency_t* lat, int vid )
+{
+    int idx;
+    for( idx = lat->out_idx[vid]; idx < lat->out_idx[vid + 1]; idx++ )
+        if( !lat->is_feedback[ lat->out_eids[idx] ] )
+            return false;
+    return true;
+}
+
+/******************************************************************************/
+bool smxana_latency_is_tt_inner( igraph_t* g, int eid )
+{
+    if( igraph_cattribute_EAN( g, GE_TYPE, eid ) != TIME_TT )
+        return false;
+    if( igraph_cattribute_EAN( g, GE_DTS, eid ) == 0
+            && igraph_cattribute_EAN( g, GE_DTNS, eid ) == 0 )
+        return false;
+    if( igraph_cattribute_EAN( g, GE_STS, eid ) == 0
+            && igraph_cattribute_EAN( g, GE_STNS, eid ) == 0 )
+        return false;
+    return true;
+}
+
+/******************************************************************************/
+void smxana_latency_print( igraph_t* g, latency_t* lat )
+{
+    int vid, eid, id_src, id_dst, id;
+    int tt_cnt = 0;
+
+    printf( " Latency report:\n" );
+    printf( "  boxes without WCET: %d\n", lat->missing_cnt );
+    printf( "  ignored feedback channels: %d\n", lat->feedback_cnt );
+    printf( "  worst-case latency per sink:\n" );
+    for( vid = 0; vid < lat->v_count; vid++ ) {
+        if( !smxana_latency_is_sink( lat, vid ) ) continue;
+        id = lat->source[vid];
+        printf( "   %s(%d) -> %s(%d): ",
+                igraph_cattribute_VAS( g, GV_LABEL, id ), id,
+                igraph_cattribute_VAS( g, GV_LABEL, vid ), vid );
+        smxana_print_time( stdout, lat->dist[vid] );
+        printf( "\n" );
+    }
+    if( lat->critical >= 0 ) {
+        printf( "  critical path (" );
+        smxana_print_time( stdout, lat->dist[lat->critical] );
+        printf( "):\n" );
+        // the path is stored backwards, print it from the sink to the source
+        vid = lat->critical;
+        while( vid >= 0 ) {
+            printf( "   %s(%d) [", igraph_cattribute_VAS( g, GV_LABEL, vid ),
+                    vid );
+            smxana_print_time( stdout, lat->cost[vid] );
+            printf( "]\n" );
+            eid = lat->pred[vid];
+            if( eid < 0 ) break;
+            igraph_edge( g, eid, &id_src, &id_dst );
+            printf( "    <- %s [", igraph_cattribute_EAS( g, GE_LABEL, eid ) );
+            smxana_print_time( stdout, lat->delay[eid] );
+            printf( "]\n" );
+            vid = id_src;
+        }
+    }
+    for( vid = 0; vid < lat->v_count; vid++ ) {
+        if( lat->period[vid] == 0 || lat->span[vid] <= lat->period[vid] )
+            continue;
+        if( tt_cnt++ == 0 ) printf( "  unmet tt periods:\n" );
+        printf( "   %s(%d): tt path ",
+                igraph_cattribute_VAS( g, GV_LABEL, vid ), vid );
+        smxana_print_time( stdout, lat->span[vid] );
+        printf( " exceeds period " );
+        smxana_print_time( stdout, lat->period[vid] );
+        printf( "\n" );
+    }
+}
+
+/******************************************************************************/
+void smxana_latency_write( igraph_t* g, latency_t* lat, FILE* out )
+{
+    int vid, eid, id_src, id_dst;
+    bool is_first = true;
+
+    fprintf( out, "{\n" );
+    fprintf( out, "  \"missing_wcet\": %d,\n", lat->missing_cnt );
+    fprintf( out, "  \"feedback_channels\": %d,\n", lat->feedback_cnt );
+    fprintf( out, "  \"sinks\": [" );
+    for( vid = 0; vid < lat->v_count; vid++ ) {
+        if( !smxana_latency_is_sink( lat, vid ) ) continue;
+        fprintf( out, "%s\n    { \"id\": %d, \"name\": ", is_first ? "" : ",",
+                vid );
+        smxana_json_write_str( out, igraph_cattribute_VAS( g, GV_LABEL, vid ) );
+        fprintf( out, ", \"source\": %d, \"latency_ns\": %" PRIu64 " }",
+                lat->source[vid], lat->dist[vid] );
+        is_first = false;
+    }
+    fprintf( out, "\n  ],\n" );
+    fprintf( out, "  \"critical_path\": {\n" );
+    fprintf( out, "    \"latency_ns\": %" PRIu64 ",\n",
+            ( lat->critical >= 0 ) ? lat->dist[lat->critical] : 0 );
+    // list the path from the sink to the source
+    fprintf( out, "    \"path\": [" );
+    is_first = true;
+    vid = lat->critical;
+    while( vid >= 0 ) {
+        fprintf( out, "%s\n      { \"id\": %d, \"name\": ",
+                is_first ? "" : ",", vid );
+        smxana_json_write_str( out, igraph_cattribute_VAS( g, GV_LABEL, vid ) );
+        fprintf( out, ", \"cost_ns\": %" PRIu64 " }", lat->cost[vid] );
+        is_first = false;
+        eid = lat->pred[vid];
+        if( eid < 0 ) break;
+        igraph_edge( g, eid, &id_src, &id_dst );
+        fprintf( out, ",\n      { \"edge\": %d, \"name\": ", eid );
+        smxana_json_write_str( out, igraph_cattribute_EAS( g, GE_LABEL, eid ) );
+        fprintf( out, ", \"delay_ns\": %" PRIu64 " }", lat->delay[eid] );
+        vid = id_src;
+    }
+    fprintf( out, "\n    ]\n  },\n" );
+    fprintf( out, "  \"unmet_tt_periods\": [" );
+    is_first = true;
+    for( vid = 0; vid < lat->v_count; vid++ ) {
+        if( lat->period[vid] == 0 || lat->span[vid] <= lat->period[vid] )
+            continue;
+        fprintf( out, "%s\n    { \"id\": %d, \"name\": ",
+                is_first ? "" : ",", vid );
+        smxana_json_write_str( out, igraph_cattribute_VAS( g, GV_LABEL, vid ) );
+        fprintf( out, ", \"wcet_ns\": %" PRIu64 ", \"path_ns\": %" PRIu64
+                ", \"period_ns\": %" PRIu64 " }", lat->cost[vid],
+                lat->span[vid], lat->period[vid] );
+        is_first = false;
+    }
+    fprintf( out, "\n  ]\n}\n" );
+}
+
+/******************************************************************************/
+void smxana_print_time( FILE* out, uint64_t time )
+{
+    if( time == 0 )
+        fprintf( out, "0ns" );
+    else if( time % 1000000000 == 0 )
+        fprintf( out, "%" PRIu64 "s", time / 1000000000 );
+    else if( time % 1000000 == 0 )
+        fprintf( out, "%" PRIu64 "ms", time / 1000000 );
+    else if( time % 1000 == 0 )
+        fprintf( out, "%" PRIu64 "us", time / 1000 );
+    else
+        fprintf( out, "%" PRIu64 "ns", time );
+}
+
+/******************************************************************************/
+int smxana_prio_inherit( igraph_t* g, int decay, int* from )
+{
+    int vid, eid, id_src, id_dst, prio;
+    int v_count = igraph_vcount( g );
+    int cnt = 0;
+    int* queue = malloc( sizeof( int ) * ( v_count + 1 ) );
+    int* own = malloc( sizeof( int ) * ( v_count + 1 ) );
+    int* eff = malloc( sizeof( int ) * ( v_count + 1 ) );
+    bool* is_queued = malloc( sizeof( bool ) * ( v_count + 1 ) );
+    bool* is_target = malloc( sizeof( bool ) * ( v_count + 1 ) );
+    int head = 0;
+    int tail = 0;
+    virt_net_t* v_net;
+    igraph_vector_t eids;
+
+    // the queue is used as a ring buffer: each vertex is queued at most once
+    for( vid = 0; vid < v_count; vid++ ) {
+        v_net = ( virt_net_t* )( uintptr_t )igraph_cattribute_VAN( g,
+                GV_VNET, vid );
+        own[vid] = igraph_cattribute_VAN( g, GV_TT, vid );
+        eff[vid] = own[vid];
+        from[vid] = -1;
+        is_target[vid] = ( v_net->type == VNET_BOX )
+            || ( v_net->type == VNET_SYNC );
+        is_queued[vid] = ( eff[vid] > 0 );
+        if( is_queued[vid] ) queue[tail++] = vid;
+    }
+
+    igraph_vector_init( &eids, 0 );
+    while( head != tail ) {
+        id_dst = queue[head];
+        head = ( head + 1 ) % ( v_count + 1 );
+        is_queued[id_dst] = false;
+        prio = eff[id_dst] - decay;
+        if( prio <= 0 ) continue;
+        igraph_incident( g, &eids, id_dst, IGRAPH_IN );
+        for( eid = 0; eid < igraph_vector_size( &eids ); eid++ ) {
+            igraph_edge( g, VECTOR( eids )[eid], &id_src, &vid );
+            if( !is_target[id_src] || eff[id_src] >= prio ) continue;
+            eff[id_src] = prio;
+            from[id_src] = id_dst;
+            if( !is_queued[id_src] ) {
+                is_queued[id_src] = true;
+                queue[tail] = id_src;
+                tail = ( tail + 1 ) % ( v_count + 1 );
+            }
+        }
+    }
+    igraph_vector_destroy( &eids );
+
+    for( vid = 0; vid < v_count; vid++ ) {
+        igraph_cattribute_VAN_set( g, GV_PRIO, vid, eff[vid] );
+        if( eff[vid] > own[vid] ) cnt++;
+        else from[vid] = -1;
+    }
+
+    free( queue );
+    free( own );
+    free( eff );
+    free( is_queued );
+    free( is_target );
+    return cnt;
+}
+
+/******************************************************************************/
+void smxana_prio_print( igraph_t* g, int* from )
+{
+    int vid, id, len;
+    int v_count = igraph_vcount( g );
+
+    for( vid = 0; vid < v_count; vid++ ) {
+        if( from[vid] < 0 ) continue;
+        printf( "   %s(%d): prio %d", igraph_cattribute_VAS( g, GV_LABEL, vid ),
+                vid, ( int )igraph_cattribute_VAN( g, GV_PRIO, vid ) );
+        id = vid;
+        len = 0;
+        // the chain is acyclic, the length check is only a safeguard
+        while( from[id] >= 0 && len++ < v_count ) {
+            id = from[id];
+            printf( " -> %s(%d)", igraph_cattribute_VAS( g, GV_LABEL, id ),
+                    id );
+        }
+        printf( " [prio %d]\n", ( int )igraph_cattribute_VAN( g, GV_TT, id ) );
+    }
+}
+
+/******************************************************************************/
+int smxana_cmp_release( const void* a, const void* b )
+{
+    const release_t* r1 = ( const release_t* )a;
+    const release_t* r2 = ( const release_t* )b;
+    if( r1->offset != r2->offset )
+        return ( r1->offset > r2->offset ) - ( r1->offset < r2->offset );
+    return r1->vid - r2->vid;
+}
+
+/******************************************************************************/
+int smxana_group_find( int* group, int vid )
+{
+    int id = vid;
+    int id_next;
+    while( group[id] != id ) id = group[id];
+    // path compression
+    while( group[vid] != id ) {
+        id_next = group[vid];
+        group[vid] = id;
+        vid = id_next;
+    }
+    return id;
+}
+
+/******************************************************************************/
+uint64_t smxana_gcd( uint64_t a, uint64_t b )
+{
+    uint64_t tmp;
+    while( b != 0 ) {
+        tmp = a % b;
+        a = b;
+        b = tmp;
+    }
+    return a;
+}
+
+/******************************************************************************/
+int smxana_tt_schedule( igraph_t* g, FILE* out )
+{
+    int vid, eid, id_src, id_dst, id_a, id_b;
+    int cnt = 0;
+    int v_count = igraph_vcount( g );
+    int* group = malloc( sizeof( int ) * ( v_count + 1 ) );
+    uint64_t* period = malloc( sizeof( uint64_t ) * ( v_count + 1 ) );
+    bool* is_done = calloc( v_count + 1, sizeof( bool ) );
+    virt_net_t* v_net;
+    igraph_es_t es;
+    igraph_eit_t eit;
+
+    for( vid = 0; vid < v_count; vid++ ) {
+        group[vid] = vid;
+        v_net = ( virt_net_t* )( uintptr_t )igraph_cattribute_VAN( g,
+                GV_VNET, vid );
+        period[vid] = 0;
+        if( v_net->type == VNET_BOX )
+            period[vid] = smxana_vertex_period( g, vid );
+    }
+
+    // vertices connected by time-triggered channels form a group
+    es = igraph_ess_all( IGRAPH_EDGEORDER_ID );
+    igraph_eit_create( g, es, &eit );
+    while( !IGRAPH_EIT_END( eit ) ) {
+        eid = IGRAPH_EIT_GET( eit );
+        IGRAPH_EIT_NEXT( eit );
+        if( igraph_cattribute_EAN( g, GE_TYPE, eid ) != TIME_TT ) continue;
+        igraph_edge( g, eid, &id_src, &id_dst );
+        id_a = smxana_group_find( group, id_src );
+        id_b = smxana_group_find( group, id_dst );
+        // the representative of a group is always its lowest vertex id
+        if( id_a < id_b ) group[id_b] = id_a;
+        else group[id_a] = id_b;
+    }
+    igraph_eit_destroy( &eit );
+    igraph_es_destroy( &es );
+
+    fprintf( out, "{\n  \"groups\": [" );
+    for( vid = 0; vid < v_count; vid++ ) {
+        if( period[vid] == 0 ) continue;
+        id_a = smxana_group_find( group, vid );
+        if( is_done[id_a] ) continue;
+        is_done[id_a] = true;
+        fprintf( out, "%s\n", ( cnt > 0 ) ? "," : "" );
+        smxana_tt_schedule_group( g, group, period, id_a, out );
+        cnt++;
+    }
+    fprintf( out, "\n  ]\n}\n" );
+
+    free( group );
+    free( period );
+    free( is_done );
+    return cnt;
+}
+
+/******************************************************************************/
+void smxana_tt_schedule_group( igraph_t* g, int* group, uint64_t* period,
+        int id_group, FILE* out )
+{
+    int vid, idx;
+    int v_count = igraph_vcount( g );
+    int rel_cnt = 0;
+    uint64_t hyper = 0;
+    uint64_t offset;
+    bool is_first = true;
+    bool is_overflow = false;
+    release_t* rels;
+
+    for( vid = id_group; vid < v_count; vid++ ) {
+        if( period[vid] == 0 || smxana_group_find( group, vid ) != id_group )
+            continue;
+        if( hyper == 0 ) hyper = period[vid];
+        else if( hyper / smxana_gcd( hyper, period[vid] )
+                > UINT64_MAX / period[vid] ) {
+            is_overflow = true;
+            break;
+        }
+        else hyper = hyper / smxana_gcd( hyper, period[vid] ) * period[vid];
+    }
+    for( vid = id_group; !is_overflow && vid < v_count; vid++ ) {
+        if( period[vid] == 0 || smxana_group_find( group, vid ) != id_group )
+            continue;
+        if( hyper / period[vid] > CONST_SCHED_MAX_RELEASES - rel_cnt )
+            is_overflow = true;
+        else rel_cnt += hyper / period[vid];
+    }
+
+    fprintf( out, "    {\n      \"id\": %d,\n", id_group );
+    if( is_overflow ) {
+        fprintf( stderr, "The hyperperiod of the tt group %d has more than %d"
+                " releases, no schedule is generated\n", id_group,
+                CONST_SCHED_MAX_RELEASES );
+        fprintf( out, "      \"error\": \"too many releases\"\n    }" );
+        return;
+    }
+    fprintf( out, "      \"hyperperiod_ns\": %" PRIu64 ",\n", hyper );
+
+    // release offsets per box
+    rels = malloc( sizeof( release_t ) * ( rel_cnt + 1 ) );
+    rel_cnt = 0;
+    fprintf( out, "      \"boxes\": [" );
+    for( vid = id_group; vid < v_count; vid++ ) {
+        if( period[vid] == 0 || smxana_group_find( group, vid ) != id_group )
+            continue;
+        fprintf( out, "%s\n        { \"id\": %d, \"name\": ",
+                is_first ? "" : ",", vid );
+        smxana_json_write_str( out, igraph_cattribute_VAS( g, GV_LABEL, vid ) );
+        fprintf( out, ", \"impl\": " );
+        smxana_json_write_str( out, igraph_cattribute_VAS( g, GV_IMPL, vid ) );
+        fprintf( out, ", \"period_ns\": %" PRIu64 ", \"offsets_ns\": [",
+                period[vid] );
+        for( offset = 0; offset < hyper; offset += period[vid] ) {
+            fprintf( out, "%s%" PRIu64, ( offset > 0 ) ? ", " : "", offset );
+            rels[rel_cnt].offset = offset;
+            rels[rel_cnt].vid = vid;
+            rel_cnt++;
+        }
+        fprintf( out, "] }" );
+        is_first = false;
+    }
+    fprintf( out, "\n      ],\n" );
+
+    // merged release table of the group
+    qsort( rels, rel_cnt, sizeof( release_t ), smxana_cmp_release );
+    fprintf( out, "      \"table\": [" );
+    for( idx = 0; idx < rel_cnt; idx++ ) {
+        if( idx == 0 || rels[idx].offset != rels[idx - 1].offset )
+            fprintf( out, "%s\n        { \"offset_ns\": %" PRIu64 ","
+                    " \"release\": [ %d", ( idx > 0 ) ? " ] }," : "",
+                    rels[idx].offset, rels[idx].vid );
+        else
+            fprintf( out, ", %d", rels[idx].vid );
+    }
+    fprintf( out, "%s\n      ]\n    }", ( rel_cnt > 0 ) ? " ] }" : "" );
+    free( rels );
+}
+
+/******************************************************************************/
+uint64_t smxana_vertex_period( igraph_t* g, int vid )
+{
+    int eid, id_src, id_dst;
+    uint64_t period;
+    uint64_t res = 0;
+    igraph_es_t es;
+    igraph_eit_t eit;
+
+    igraph_es_incident( &es, vid, IGRAPH_ALL );
+    igraph_eit_create( g, es, &eit );
+    while( !IGRAPH_EIT_END( eit ) ) {
+        eid = IGRAPH_EIT_GET( eit );
+        IGRAPH_EIT_NEXT( eit );
+        if( igraph_cattribute_EAN( g, GE_TYPE, eid ) != TIME_TT ) continue;
+        igraph_edge( g, eid, &id_src, &id_dst );
+        if( id_dst == vid )
+            period = ( uint64_t )igraph_cattribute_EAN( g, GE_DTS, eid )
+                * 1000000000 + igraph_cattribute_EAN( g, GE_DTNS, eid );
+        else
+            period = ( uint64_t )igraph_cattribute_EAN( g, GE_STS, eid )
+                * 1000000000 + igraph_cattribute_EAN( g, GE_STNS, eid );
+        if( period > 0 && ( res == 0 || period < res ) )
+            res = period;
+    }
+    igraph_eit_destroy( &eit );
+    igraph_es_destroy( &es );
+    return res;
+}
+
+/******************************************************************************/
+void smxana_wcet_destroy( wcet_t** wcets )
+{
+    wcet_t* wcet;
+    wcet_t* tmp;
+    HASH_ITER( hh, *wcets, wcet, tmp ) {
+        HASH_DEL( *wcets, wcet );
+        free( wcet->name );
+        free( wcet );
+    }
+}
+
+/******************************************************************************/
+bool smxana_wcet_get( wcet_t* wcets, const char* impl, const char* name,
+        uint64_t* time )
+{
+    if( smxana_wcet_get_list( wcets, impl, time ) )
+        return true;
+    if( smxana_wcet_get_list( wcets, name, time ) )
+        return true;
+    *time = 0;
+    return false;
+}
+
+/******************************************************************************/
+bool smxana_wcet_get_list( wcet_t* wcets, const char* list, uint64_t* time )
+{
+    wcet_t* wcet;
+    char* names;
+    char* name;
+    char* save;
+    bool res = true;
+
+    *time = 0;
+    if( wcets == NULL || list == NULL ) return false;
+    names = strdup( list );
+    name = strtok_r( names, TEXT_IMPL_SEP, &save );
+    if( name == NULL ) res = false;
+    while( name != NULL ) {
+        HASH_FIND_STR( wcets, name, wcet );
+        if( wcet == NULL ) {
+            res = false;
+            break;
+        }
+        *time += wcet->time;
+        name = strtok_r( NULL, TEXT_IMPL_SEP, &save );
+    }
+    free( names );
+    return res;
+}
+
+/******************************************************************************/
+int smxana_wcet_read( const char* path, wcet_t** wcets )
+{
+    FILE* file;
+    char* line = NULL;
+    char* name;
+    char* value;
+    char* unit;
+    char* save;
+    size_t size = 0;
+    int line_nb = 0;
+    int res = 0;
+    uint64_t time;
+    wcet_t* wcet;
+
+    file = fopen( path, "r" );
+    if( file == NULL ) {
+        fprintf( stderr, "Cannot open file '%s'!\n", path );
+        return -1;
+    }
+    while( getline( &line, &size, file ) != -1 ) {
+        line_nb++;
+        name = strtok_r( line, " \t\r\n", &save );
+        if( name == NULL || name[0] == '#' ) continue;
+        value = strtok_r( NULL, " \t\r\n", &save );
+        if( value == NULL ) {
+            fprintf( stderr, "%s:%d: missing WCET of '%s'\n", path, line_nb,
+                    name );
+            res = -1;
+            continue;
+        }
+        time = strtoull( value, &unit, 10 );
+        if( unit == value ) {
+            fprintf( stderr, "%s:%d: bad WCET '%s'\n", path, line_nb, value );
+            res = -1;
+            continue;
+        }
+        if( strcmp( unit, "s" ) == 0 ) time *= 1000000000;
+        else if( strcmp( unit, "ms" ) == 0 ) time *= 1000000;
+        else if( strcmp( unit, "us" ) == 0 ) time *= 1000;
+        else if( ( strcmp( unit, "ns" ) != 0 ) && ( *unit != '\0' ) ) {
+            fprintf( stderr, "%s:%d: bad time unit '%s'\n", path, line_nb,
+                    unit );
+            res = -1;
+            continue;
+        }
+        HASH_FIND_STR( *wcets, name, wcet );
+        if( wcet == NULL ) {
+            wcet = malloc( sizeof( wcet_t ) );
+            wcet->name = strdup( name );
+            HASH_ADD_KEYPTR( hh, *wcets, wcet->name, strlen( wcet->name ),
+                    wcet );
+        }
+        wcet->time = time;
+    }
+    free( line );
+    fclose( file );
+    return res;
+}
@@ -0,0 +1,229 @@
+/**
+ * Generate a C translation unit describing the static setup of the network
+ *
+ * @file    smxcgen.c
+ * @author  Simon Maurer
+ *
+ */
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "smxcgen.h"
+#include "defines.h"
+
+/******************************************************************************/
+void smxcgen_write( igraph_t* g, FILE* out_file, const char* name )
+{
+    int vid, eid, id_src, id_dst;
+    int v_cnt = igraph_vcount( g );
+    int e_cnt = igraph_ecount( g );
+    int* in_first = malloc( sizeof( int ) * ( v_cnt + 1 ) );
+    int* in_cnt = malloc( sizeof( int ) * ( v_cnt + 1 ) );
+    int* out_first = malloc( sizeof( int ) * ( v_cnt + 1 ) );
+    int* out_cnt = malloc( sizeof( int ) * ( v_cnt + 1 ) );
+    int* stage_first = malloc( sizeof( int ) * ( v_cnt + 1 ) );
+    int* stage_cnt = malloc( sizeof( int ) * ( v_cnt + 1 ) );
+    bool has_prio = igraph_cattribute_has_attr( g, IGRAPH_ATTRIBUTE_VERTEX,
+            GV_PRIO );
+    bool has_class = igraph_cattribute_has_attr( g, IGRAPH_ATTRIBUTE_EDGE,
+            GE_CLASS );
+
+    fprintf( out_file, "/**\n * Static setup of the streamix network '%s'\n"
+            " *\n * Generated by smxc, do not edit.\n */\n\n", name );
+    fprintf( out_file, "#include <stdbool.h>\n#include <stddef.h>\n\n" );
+    smxcgen_write_types( out_file );
+    smxcgen_write_impls( g, out_file );
+
+    smxcgen_write_wiring( g, out_file, "smx_cgen_box_in", IGRAPH_IN, in_first,
+            in_cnt );
+    smxcgen_write_wiring( g, out_file, "smx_cgen_box_out", IGRAPH_OUT,
+            out_first, out_cnt );
+    smxcgen_write_stages( g, out_file, stage_first, stage_cnt );
+
+    fprintf( out_file, "const smx_cgen_channel_t smx_cgen_channels[] = {\n" );
+    for( eid = 0; eid < e_cnt; eid++ ) {
+        igraph_edge( g, eid, &id_src, &id_dst );
+        fprintf( out_file, "    { \"%s\", %d, %d, %d, %d, %d, %d, %d,"
+                " { %ld, %ld }, { %ld, %ld }, %d, %d },\n",
+                igraph_cattribute_EAS( g, GE_LABEL, eid ),
+                ( int )igraph_cattribute_EAN( g, GE_LEN, eid ),
+                ( int )igraph_cattribute_EAN( g, GE_DSRC, eid ),
+                ( int )igraph_cattribute_EAN( g, GE_DDST, eid ),
+                ( int )igraph_cattribute_EAN( g, GE_DYNSRC, eid ),
+                ( int )igraph_cattribute_EAN( g, GE_DYNDST, eid ),
+                ( int )igraph_cattribute_EAN( g, GE_TYPE, eid ),
+                has_class ? ( int )igraph_cattribute_EAN( g, GE_CLASS, eid )
+                    : 0,
+                ( long )igraph_cattribute_EAN( g, GE_STS, eid ),
+                ( long )igraph_cattribute_EAN( g, GE_STNS, eid ),
+                ( long )igraph_cattribute_EAN( g, GE_DTS, eid ),
+                ( long )igraph_cattribute_EAN( g, GE_DTNS, eid ),
+                id_src, id_dst );
+    }
+    if( e_cnt == 0 ) fprintf( out_file, "    { 0 }\n" );
+    fprintf( out_file, "};\n" );
+    fprintf( out_file, "const int smx_cgen_channel_cnt = %d;\n\n", e_cnt );
+
+    fprintf( out_file, "const smx_cgen_box_t smx_cgen_boxes[] = {\n" );
+    for( vid = 0; vid < v_cnt; vid++ ) {
+        fprintf( out_file, "    { \"%s\", ", igraph_cattribute_VAS( g,
+                    GV_LABEL, vid ) );
+        if( stage_cnt[vid] > 0 )
+            fprintf( out_file, "smx_cgen_stages + %d, %d, ", stage_first[vid],
+                    stage_cnt[vid] );
+        else fprintf( out_file, "NULL, 0, " );
+        fprintf( out_file, "%d, %d, %d, %d, %d, %d, %d, %d },\n",
+                ( int )igraph_cattribute_VAN( g, has_prio ? GV_PRIO : GV_TT,
+                    vid ),
+                ( int )igraph_cattribute_VAN( g, GV_PURE, vid ),
+                ( int )igraph_cattribute_VAN( g, GV_STATIC, vid ),
+                ( int )igraph_cattribute_VAN( g, GV_LOCATION, vid ),
+                in_first[vid], in_cnt[vid], out_first[vid], out_cnt[vid] );
+    }
+    if( v_cnt == 0 ) fprintf( out_file, "    { 0 }\n" );
+    fprintf( out_file, "};\n" );
+    fprintf( out_file, "const int smx_cgen_box_cnt = %d;\n", v_cnt );
+
+    free( in_first );
+    free( in_cnt );
+    free( out_first );
+    free( out_cnt );
+    free( stage_first );
+    free( stage_cnt );
+}
+
+/******************************************************************************/
+void smxcgen_write_impls( igraph_t* g, FILE* out_file )
+{
+    int vid;
+    char* names;
+    char* name;
+    char* save;
+    cgen_impl_t* impls = NULL;
+    cgen_impl_t* impl;
+    cgen_impl_t* tmp;
+
+    // the implementation of a fused box lists the implementations of all its
+    // stages
+    for( vid = 0; vid < igraph_vcount( g ); vid++ ) {
+        names = strdup( igraph_cattribute_VAS( g, GV_IMPL, vid ) );
+        name = strtok_r( names, TEXT_IMPL_SEP, &save );
+        while( name != NULL ) {
+            HASH_FIND_STR( impls, name, impl );
+            if( impl == NULL ) {
+                impl = malloc( sizeof( cgen_impl_t ) );
+                impl->name = strdup( name );
+                HASH_ADD_KEYPTR( hh, impls, impl->name, strlen( impl->name ),
+                        impl );
+                fprintf( out_file, "extern int %s( void*, void* );\n", name );
+            }
+            name = strtok_r( NULL, TEXT_IMPL_SEP, &save );
+        }
+        free( names );
+    }
+    fprintf( out_file, "\n" );
+
+    HASH_ITER( hh, impls, impl, tmp ) {
+        HASH_DEL( impls, impl );
+        free( ( char* )impl->name );
+        free( impl );
+    }
+}
+
+/******************************************************************************/
+void smxcgen_write_stages( igraph_t* g, FILE* out_file, int* first, int* cnt )
+{
+    int vid;
+    int idx = 0;
+    char* names;
+    char* name;
+    char* save;
+
+    fprintf( out_file, "const smx_cgen_impl_t smx_cgen_stages[] = {" );
+    for( vid = 0; vid < igraph_vcount( g ); vid++ ) {
+        first[vid] = idx;
+        cnt[vid] = 0;
+        names = strdup( igraph_cattribute_VAS( g, GV_IMPL, vid ) );
+        name = strtok_r( names, TEXT_IMPL_SEP, &save );
+        while( name != NULL ) {
+            fprintf( out_file, "%s%s,", ( idx % 8 == 0 ) ? "\n    " : " ",
+                    name );
+            cnt[vid]++;
+            idx++;
+            name = strtok_r( NULL, TEXT_IMPL_SEP, &save );
+        }
+        free( names );
+    }
+    if( idx == 0 ) fprintf( out_file, "\n    NULL" );
+    fprintf( out_file, "\n};\n\n" );
+}
+
+/******************************************************************************/
+void smxcgen_write_types( FILE* out_file )
+{
+    fprintf( out_file,
+            "#ifndef SMX_CGEN_TYPES\n"
+            "#define SMX_CGEN_TYPES\n"
+            "typedef int ( *smx_cgen_impl_t )( void*, void* );\n\n"
+            "typedef struct smx_cgen_time_s\n"
+            "{\n"
+            "    long tv_sec;\n"
+            "    long tv_nsec;\n"
+            "} smx_cgen_time_t;\n\n"
+            "typedef struct smx_cgen_channel_s\n"
+            "{\n"
+            "    const char* name;\n"
+            "    int len;\n"
+            "    bool is_decoupled_src;\n"
+            "    bool is_decoupled_dst;\n"
+            "    bool is_dynamic_src;\n"
+            "    bool is_dynamic_dst;\n"
+            "    int rate_type;\n"
+            "    int ch_class;\n"
+            "    smx_cgen_time_t time_src;\n"
+            "    smx_cgen_time_t time_dst;\n"
+            "    int box_src;\n"
+            "    int box_dst;\n"
+            "} smx_cgen_channel_t;\n\n"
+            "typedef struct smx_cgen_box_s\n"
+            "{\n"
+            "    const char* name;\n"
+            "    const smx_cgen_impl_t* stages;\n"
+            "    int stage_cnt;\n"
+            "    int prio;\n"
+            "    bool is_pure;\n"
+            "    bool is_static;\n"
+            "    int location;\n"
+            "    int in_first;\n"
+            "    int in_cnt;\n"
+            "    int out_first;\n"
+            "    int out_cnt;\n"
+            "} smx_cgen_box_t;\n"
+            "#endif /* SMX_CGEN_TYPES */\n\n" );
+}
+
+/******************************************************************************/
+void smxcgen_write_wiring( igraph_t* g, FILE* out_file, const char* name,
+        igraph_neimode_t mode, int* first, int* cnt )
+{
+    int vid, i;
+    int idx = 0;
+    igraph_vector_t eids;
+
+    igraph_vector_init( &eids, 0 );
+    fprintf( out_file, "const int %s[] = {", name );
+    for( vid = 0; vid < igraph_vcount( g ); vid++ ) {
+        igraph_incident( g, &eids, vid, mode );
+        first[vid] = idx;
+        cnt[vid] = igraph_vector_size( &eids );
+        for( i = 0; i < cnt[vid]; i++ ) {
+            fprintf( out_file, "%s%d,", ( idx % 16 == 0 ) ? "\n    " : " ",
+                    ( int )VECTOR( eids )[i] );
+            idx++;
+        }
+    }
+    if( idx == 0 ) fprintf( out_file, "\n    0" );
+    fprintf( out_file, "\n};\n\n" );
+    igraph_vector_destroy( &eids );
+}
@@ -0,0 +1,409 @@
+/**
+ * Change set between two flattened graphs for incremental redeploys
+ *
+ * @file    smxdiff.c
+ * @author  Simon Maurer
+ *
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "smxdiff.h"
+#include "defines.h"
+
+/******************************************************************************/
+void smxdiff_attrs( graph_diff_t* diff, diff_set_t* set )
+{
+    igraph_strvector_t g_names, v_names, e_names, names_old;
+    igraph_vector_t g_types, v_types, e_types, types, types_old;
+    const char* name;
+    int i, j;
+
+    igraph_strvector_init( &g_names, 0 );
+    igraph_strvector_init( &v_names, 0 );
+    igraph_strvector_init( &e_names, 0 );
+    igraph_vector_init( &g_types, 0 );
+    igraph_vector_init( &v_types, 0 );
+    igraph_vector_init( &e_types, 0 );
+    igraph_vector_init( &types, 0 );
+    igraph_vector_init( &types_old, 0 );
+    igraph_strvector_init( &set->names, 0 );
+    igraph_strvector_init( &names_old, 0 );
+    if( set->elem == IGRAPH_ATTRIBUTE_VERTEX ) {
+        igraph_cattribute_list( diff->g, &g_names, &g_types, &set->names,
+                &types, &e_names, &e_types );
+        igraph_cattribute_list( diff->g_old, &g_names, &g_types, &names_old,
+                &types_old, &e_names, &e_types );
+    }
+    else {
+        igraph_cattribute_list( diff->g, &g_names, &g_types, &v_names,
+                &v_types, &set->names, &types );
+        igraph_cattribute_list( diff->g_old, &g_names, &g_types, &v_names,
+                &v_types, &names_old, &types_old );
+    }
+
+    set->attrs = malloc( sizeof( diff_attr_t )
+            * ( igraph_strvector_size( &set->names ) + 1 ) );
+    set->attr_cnt = 0;
+    for( i = 0; i < igraph_strvector_size( &set->names ); i++ ) {
+        name = STR( set->names, i );
+        // ids change with every compilation, paths are used to match
+        if( strcmp( name, "id" ) == 0 || strcmp( name, GV_PATH ) == 0
+                || strcmp( name, GV_ORIG_ID ) == 0 )
+            continue;
+        for( j = 0; j < igraph_strvector_size( &names_old ); j++ ) {
+            if( strcmp( name, STR( names_old, j ) ) != 0 ) continue;
+            if( VECTOR( types )[i] == VECTOR( types_old )[j] ) {
+                set->attrs[set->attr_cnt].name = name;
+                set->attrs[set->attr_cnt].type = VECTOR( types )[i];
+                set->attr_cnt++;
+            }
+            break;
+        }
+    }
+
+    igraph_strvector_destroy( &g_names );
+    igraph_strvector_destroy( &v_names );
+    igraph_strvector_destroy( &e_names );
+    igraph_strvector_destroy( &names_old );
+    igraph_vector_destroy( &g_types );
+    igraph_vector_destroy( &v_types );
+    igraph_vector_destroy( &e_types );
+    igraph_vector_destroy( &types );
+    igraph_vector_destroy( &types_old );
+}
+
+/******************************************************************************/
+int smxdiff_cmp( graph_diff_t* diff, diff_set_t* set, int id, FILE* out )
+{
+    int i;
+    int id_old = set->match[id];
+    int cnt = 0;
+    bool is_equal;
+    bool is_v = ( set->elem == IGRAPH_ATTRIBUTE_VERTEX );
+    const char* name;
+    double val, val_old;
+
+    for( i = 0; i < set->attr_cnt; i++ ) {
+        name = set->attrs[i].name;
+        if( set->attrs[i].type == IGRAPH_ATTRIBUTE_STRING )
+            is_equal = ( strcmp(
+                    is_v ? igraph_cattribute_VAS( diff->g, name, id )
+                        : igraph_cattribute_EAS( diff->g, name, id ),
+                    is_v ? igraph_cattribute_VAS( diff->g_old, name, id_old )
+                        : igraph_cattribute_EAS( diff->g_old, name, id_old ) )
+                    == 0 );
+        else if( set->attrs[i].type == IGRAPH_ATTRIBUTE_BOOLEAN )
+            is_equal = ( is_v ? igraph_cattribute_VAB( diff->g, name, id )
+                        : igraph_cattribute_EAB( diff->g, name, id ) )
+                == ( is_v ? igraph_cattribute_VAB( diff->g_old, name, id_old )
+                        : igraph_cattribute_EAB( diff->g_old, name, id_old ) );
+        else {
+            val = is_v ? igraph_cattribute_VAN( diff->g, name, id )
+                : igraph_cattribute_EAN( diff->g, name, id );
+            val_old = is_v ? igraph_cattribute_VAN( diff->g_old, name, id_old )
+                : igraph_cattribute_EAN( diff->g_old, name, id_old );
+            is_equal = ( val == val_old )
+                || ( isnan( val ) && isnan( val_old ) );
+        }
+        if( is_equal ) continue;
+        if( out != NULL )
+            fprintf( out, "%s\"%s\"", ( cnt > 0 ) ? ", " : "", name );
+        cnt++;
+    }
+    return cnt;
+}
+
+/******************************************************************************/
+int smxdiff_compute( igraph_t* g_old, igraph_t* g, graph_diff_t* diff )
+{
+    int i;
+    diff_set_t* sets[2] = { &diff->v, &diff->e };
+
+    if( !igraph_cattribute_has_attr( g, IGRAPH_ATTRIBUTE_VERTEX, GV_PATH )
+            || !igraph_cattribute_has_attr( g_old, IGRAPH_ATTRIBUTE_VERTEX,
+                GV_PATH ) )
+        return -1;
+
+    diff->g_old = g_old;
+    diff->g = g;
+    diff->v.elem = IGRAPH_ATTRIBUTE_VERTEX;
+    diff->v.cnt = igraph_vcount( g );
+    diff->v.cnt_old = igraph_vcount( g_old );
+    diff->v.keys = smxdiff_keys_v( g );
+    diff->v.keys_old = smxdiff_keys_v( g_old );
+    diff->e.elem = IGRAPH_ATTRIBUTE_EDGE;
+    diff->e.cnt = igraph_ecount( g );
+    diff->e.cnt_old = igraph_ecount( g_old );
+    diff->e.keys = smxdiff_keys_e( g, diff->v.keys );
+    diff->e.keys_old = smxdiff_keys_e( g_old, diff->v.keys_old );
+
+    for( i = 0; i < 2; i++ ) {
+        smxdiff_attrs( diff, sets[i] );
+        smxdiff_match( diff, sets[i] );
+    }
+    return 0;
+}
+
+/******************************************************************************/
+void smxdiff_destroy( graph_diff_t* diff )
+{
+    int i, id;
+    diff_set_t* set;
+    diff_set_t* sets[2] = { &diff->v, &diff->e };
+
+    for( i = 0; i < 2; i++ ) {
+        set = sets[i];
+        for( id = 0; id < set->cnt; id++ )
+            free( set->keys[id] );
+        for( id = 0; id < set->cnt_old; id++ )
+            free( set->keys_old[id] );
+        free( set->keys );
+        free( set->keys_old );
+        free( set->match );
+        free( set->match_old );
+        free( set->is_mod );
+        free( set->attrs );
+        igraph_strvector_destroy( &set->names );
+    }
+}
+
+/******************************************************************************/
+int smxdiff_key_cmp( const void* a, const void* b )
+{
+    return strcmp( *( char* const* )a, *( char* const* )b );
+}
+
+/******************************************************************************/
+char* smxdiff_key_unique( diff_key_t** uses, char* key )
+{
+    diff_key_t* use;
+    char* key_new;
+
+    HASH_FIND_STR( *uses, key, use );
+    if( use == NULL ) {
+        use = malloc( sizeof( diff_key_t ) );
+        use->key = strdup( key );
+        use->id = 1;
+        HASH_ADD_KEYPTR( hh, *uses, use->key, strlen( use->key ), use );
+        return key;
+    }
+    key_new = malloc( strlen( key ) + CONST_ID_LEN + 2 );
+    sprintf( key_new, "%s#%d", key, use->id++ );
+    free( key );
+    return key_new;
+}
+
+/******************************************************************************/
+char** smxdiff_keys_e( igraph_t* g, char** v_keys )
+{
+    int eid, id_src, id_dst;
+    const char* label;
+    char* key;
+    char** keys = malloc( sizeof( char* ) * ( igraph_ecount( g ) + 1 ) );
+    diff_key_t* uses = NULL;
+    diff_key_t* use;
+    diff_key_t* tmp;
+
+    for( eid = 0; eid < igraph_ecount( g ); eid++ ) {
+        igraph_edge( g, eid, &id_src, &id_dst );
+        label = igraph_cattribute_EAS( g, GE_LABEL, eid );
+        key = malloc( strlen( v_keys[id_src] ) + strlen( label )
+                + strlen( v_keys[id_dst] ) + 3 );
+        sprintf( key, "%s:%s>%s", v_keys[id_src], label, v_keys[id_dst] );
+        keys[eid] = smxdiff_key_unique( &uses, key );
+    }
+
+    HASH_ITER( hh, uses, use, tmp ) {
+        HASH_DEL( uses, use );
+        free( use->key );
+        free( use );
+    }
+    return keys;
+}
+
+/******************************************************************************/
+char** smxdiff_keys_v( igraph_t* g )
+{
+    int vid, i, len, id_src, id_dst, eid;
+    int v_count = igraph_vcount( g );
+    const char* label;
+    const char* name;
+    char* key;
+    char** keys = malloc( sizeof( char* ) * ( v_count + 1 ) );
+    char** ports;
+    bool* is_rn = malloc( sizeof( bool ) * ( v_count + 1 ) );
+    igraph_vector_t eids;
+    diff_key_t* uses = NULL;
+    diff_key_t* use;
+    diff_key_t* tmp;
+
+    // boxes are identified by their path
+    for( vid = 0; vid < v_count; vid++ ) {
+        label = igraph_cattribute_VAS( g, GV_LABEL, vid );
+        is_rn[vid] = ( strcmp( label, TEXT_CP ) == 0 )
+            || ( strcmp( label, TEXT_FARM_DISPATCH ) == 0 )
+            || ( strcmp( label, TEXT_FARM_COLLECT ) == 0 );
+        keys[vid] = NULL;
+        if( is_rn[vid] ) continue;
+        keys[vid] = smxdiff_key_unique( &uses,
+                strdup( igraph_cattribute_VAS( g, GV_PATH, vid ) ) );
+    }
+
+    // routing nodes of the same net share the path and are identified by
+    // their neighbours, i.e. the keys of boxes and the paths of routing nodes
+    igraph_vector_init( &eids, 0 );
+    for( vid = 0; vid < v_count; vid++ ) {
+        if( !is_rn[vid] ) continue;
+        igraph_incident( g, &eids, vid, IGRAPH_ALL );
+        ports = malloc( sizeof( char* ) * ( igraph_vector_size( &eids ) + 1 ) );
+        len = strlen( igraph_cattribute_VAS( g, GV_PATH, vid ) ) + 3;
+        for( i = 0; i < igraph_vector_size( &eids ); i++ ) {
+            eid = VECTOR( eids )[i];
+            igraph_edge( g, eid, &id_src, &id_dst );
+            id_src = ( id_src == vid ) ? id_dst : id_src;
+            name = is_rn[id_src] ? igraph_cattribute_VAS( g, GV_PATH, id_src )
+                : keys[id_src];
+            label = igraph_cattribute_EAS( g, GE_LABEL, eid );
+            ports[i] = malloc( strlen( name ) + strlen( label ) + 6 );
+            sprintf( ports[i], "%s:%s.%s", ( id_dst == vid ) ? "in" : "out",
+                    name, label );
+            len += strlen( ports[i] ) + 1;
+        }
+        qsort( ports, igraph_vector_size( &eids ), sizeof( char* ),
+                smxdiff_key_cmp );
+        key = malloc( len );
+        len = sprintf( key, "%s(", igraph_cattribute_VAS( g, GV_PATH, vid ) );
+        for( i = 0; i < igraph_vector_size( &eids ); i++ ) {
+            len += sprintf( &key[len], "%s%s", ( i > 0 ) ? "," : "",
+                    ports[i] );
+            free( ports[i] );
+        }
+        sprintf( &key[len], ")" );
+        free( ports );
+        keys[vid] = smxdiff_key_unique( &uses, key );
+    }
+    igraph_vector_destroy( &eids );
+
+    HASH_ITER( hh, uses, use, tmp ) {
+        HASH_DEL( uses, use );
+        free( use->key );
+        free( use );
+    }
+    free( is_rn );
+    return keys;
+}
+
+/******************************************************************************/
+void smxdiff_match( graph_diff_t* diff, diff_set_t* set )
+{
+    int id;
+    diff_key_t* index = NULL;
+    diff_key_t* entry;
+    diff_key_t* tmp;
+
+    set->match = malloc( sizeof( int ) * ( set->cnt + 1 ) );
+    set->match_old = malloc( sizeof( int ) * ( set->cnt_old + 1 ) );
+    set->is_mod = malloc( sizeof( bool ) * ( set->cnt + 1 ) );
+    set->added_cnt = 0;
+    set->removed_cnt = 0;
+    set->modified_cnt = 0;
+    set->moved_cnt = 0;
+
+    // the keys are unique, the hash table refers to them without copying
+    for( id = 0; id < set->cnt_old; id++ ) {
+        set->match_old[id] = -1;
+        entry = malloc( sizeof( diff_key_t ) );
+        entry->key = set->keys_old[id];
+        entry->id = id;
+        HASH_ADD_KEYPTR( hh, index, entry->key, strlen( entry->key ), entry );
+    }
+    for( id = 0; id < set->cnt; id++ ) {
+        HASH_FIND_STR( index, set->keys[id], entry );
+        set->match[id] = ( entry == NULL ) ? -1 : entry->id;
+        set->is_mod[id] = false;
+        if( entry == NULL ) {
+            set->added_cnt++;
+            continue;
+        }
+        set->match_old[entry->id] = id;
+        set->is_mod[id] = ( smxdiff_cmp( diff, set, id, NULL ) > 0 );
+        if( set->is_mod[id] ) set->modified_cnt++;
+        else if( entry->id != id ) set->moved_cnt++;
+    }
+    for( id = 0; id < set->cnt_old; id++ )
+        if( set->match_old[id] < 0 ) set->removed_cnt++;
+
+    HASH_ITER( hh, index, entry, tmp ) {
+        HASH_DEL( index, entry );
+        free( entry );
+    }
+}
+
+/******************************************************************************/
+void smxdiff_print( graph_diff_t* diff )
+{
+    printf( " Graph diff: %d vertex(es) added, %d removed, %d modified;"
+            " %d channel(s) added, %d removed, %d modified\n",
+            diff->v.added_cnt, diff->v.removed_cnt, diff->v.modified_cnt,
+            diff->e.added_cnt, diff->e.removed_cnt, diff->e.modified_cnt );
+    if( diff->v.moved_cnt > 0 || diff->e.moved_cnt > 0 )
+        printf( "  %d vertex(es) and %d channel(s) unchanged but renumbered\n",
+                diff->v.moved_cnt, diff->e.moved_cnt );
+}
+
+/******************************************************************************/
+void smxdiff_write( graph_diff_t* diff, FILE* out )
+{
+    fprintf( out, "{\n  \"vertices\": {" );
+    smxdiff_write_set( diff, &diff->v, out );
+    fprintf( out, "\n  },\n  \"channels\": {" );
+    smxdiff_write_set( diff, &diff->e, out );
+    fprintf( out, "\n  }\n}\n" );
+}
+
+/******************************************************************************/
+void smxdiff_write_set( graph_diff_t* diff, diff_set_t* set, FILE* out )
+{
+    int id;
+    bool is_first = true;
+
+    fprintf( out, "\n    \"added\": [" );
+    for( id = 0; id < set->cnt; id++ ) {
+        if( set->match[id] >= 0 ) continue;
+        fprintf( out, "%s\n      { \"id\": %d, \"key\": \"%s\" }",
+                is_first ? "" : ",", id, set->keys[id] );
+        is_first = false;
+    }
+    fprintf( out, "\n    ],\n    \"removed\": [" );
+    is_first = true;
+    for( id = 0; id < set->cnt_old; id++ ) {
+        if( set->match_old[id] >= 0 ) continue;
+        fprintf( out, "%s\n      { \"old_id\": %d, \"key\": \"%s\" }",
+                is_first ? "" : ",", id, set->keys_old[id] );
+        is_first = false;
+    }
+    fprintf( out, "\n    ],\n    \"modified\": [" );
+    is_first = true;
+    for( id = 0; id < set->cnt; id++ ) {
+        if( !set->is_mod[id] ) continue;
+        fprintf( out, "%s\n      { \"id\": %d, \"old_id\": %d, \"key\": \"%s\","
+                " \"attrs\": [ ", is_first ? "" : ",", id, set->match[id],
+                set->keys[id] );
+        smxdiff_cmp( diff, set, id, out );
+        fprintf( out, " ] }" );
+        is_first = false;
+    }
+    // unchanged elements with a new id, needed to remap the runtime tables
+    fprintf( out, "\n    ],\n    \"moved\": [" );
+    is_first = true;
+    for( id = 0; id < set->cnt; id++ ) {
+        if( set->match[id] < 0 || set->is_mod[id] || set->match[id] == id )
+            continue;
+        fprintf( out, "%s\n      { \"id\": %d, \"old_id\": %d }",
+                is_first ? "" : ",", id, set->match[id] );
+        is_first = false;
+    }
+    fprintf( out, "\n    ]" );
+}
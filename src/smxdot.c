@@ -13,6 +13,7 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include "utarray.h"
 
 #ifdef DOT_AST
 char* node_label[] =
@@ -36,6 +37,7 @@ char* node_label[] =
     "tt",
     "rt",
     "tf",
+    "farm",
     "wrapper decl"
 };
 char* mode_label[] = {
@@ -143,14 +145,14 @@ void draw_ast_graph_step( FILE* graph, ast_node_t* ptr )
         case AST_PARALLEL_DET:
             graph_add_node( graph, ptr->id, node_label[ ptr->type ],
                     STYLE_N_AST_NODE );
-            // continue on the left branch
-            draw_ast_graph_step( graph, ptr->op->left );
-            graph_add_edge( graph, ptr->id, ptr->op->left->id, NULL,
-                    STYLE_E_DEFAULT );
-            // continue on the right branch
-            draw_ast_graph_step( graph, ptr->op->right );
-            graph_add_edge( graph, ptr->id, ptr->op->right->id, NULL,
-                    STYLE_E_DEFAULT );
+            // iterate through all operands
+            ast_list_ptr = ptr->op->ops;
+            while( ast_list_ptr != 0 ) {
+                draw_ast_graph_step( graph, ast_list_ptr->node );
+                graph_add_edge( graph, ptr->id, ast_list_ptr->node->id,
+                        NULL, STYLE_E_DEFAULT );
+                ast_list_ptr = ast_list_ptr->next;
+            }
             break;
         // draw simple nodes
         case AST_NET:
@@ -266,6 +268,12 @@ void draw_ast_graph_step( FILE* graph, ast_node_t* ptr )
                 graph_add_edge( graph, ptr->id, ptr->port->ch_len->id, NULL,
                         STYLE_E_DEFAULT );
             }
+            // msg_size
+            if( ptr->port->msg_size != NULL ) {
+                draw_ast_graph_step( graph, ptr->port->msg_size );
+                graph_add_edge( graph, ptr->id, ptr->port->msg_size->id, NULL,
+                        STYLE_E_DEFAULT );
+            }
             break;
         case AST_TT:
         case AST_TB:
@@ -275,6 +283,13 @@ void draw_ast_graph_step( FILE* graph, ast_node_t* ptr )
             graph_add_edge( graph, ptr->id, ptr->time->op->id, NULL,
                     STYLE_E_DEFAULT );
             break;
+        case AST_FARM:
+            graph_add_node( graph, ptr->id, node_label[ ptr->type ],
+                    STYLE_N_AST_NODE );
+            draw_ast_graph_step( graph, ptr->farm->op );
+            graph_add_edge( graph, ptr->id, ptr->farm->op->id, NULL,
+                    STYLE_E_DEFAULT );
+            break;
         default:
             ;
     }
@@ -410,71 +425,128 @@ void graph_finish_subgraph( FILE* graph )
 
 #ifdef DOT_CON
 /******************************************************************************/
-void graph_fix_dot( char* t_path, char* r_path )
+void graph_fix_dot( char* r_path )
 {
 #if defined(DEBUG) || defined(DEBUG_GRAPH)
-    char d_path[40];
+    char* d_path;
     FILE* d_graph;
 #endif // DEBUG
     FILE* r_graph;
-    FILE* t_graph;
-    char str[512];
-    char* ptr = NULL;
+    char* buf;
+    char* line;
+    char* eol;
+    char* ptr;
+    long size;
+    size_t lead_len;
     char flag;
     char next_flag = FLAG_STMTS; // first flag will always be STMTS
-    int scope = 0;
+    int scope;
     int last_scope = -1;
+    int block_cnt = 0;
     int iteration_cnt = 0;
-    bool copy = false;
+    int* scope_ptr = NULL;
     bool done = false;
-    char pattern[ sizeof( DOT_PATTERN ) + 10 ] = DOT_PATTERN;
-    t_graph = fopen( t_path, "w" );
+    UT_array* scopes;
+    dot_bucket_t* buckets = NULL;
+    dot_bucket_t* bucket;
+    dot_bucket_t* tmp;
+    dot_block_t* block = NULL;
+    dot_block_t* block_next;
+    dot_block_t* last;
+
+    // read the whole file at once
+    r_graph = fopen( r_path, "r" );
+    if( r_graph == NULL ) {
+        printf( "Cannot open file '%s'!\n", r_path );
+        return;
+    }
+    fseek( r_graph, 0, SEEK_END );
+    size = ftell( r_graph );
+    rewind( r_graph );
+    buf = malloc( size + 1 );
+    size = fread( buf, 1, size, r_graph );
+    buf[size] = '\0';
+    fclose( r_graph );
+#if defined(DEBUG) || defined(DEBUG_GRAPH)
+    // save the original file in order to debug
+    d_path = malloc( strlen( r_path ) + 5 );
+    sprintf( d_path, "%s.dbg", r_path );
+    d_graph = fopen( d_path, "w" );
+    fwrite( buf, 1, size, d_graph );
+    fclose( d_graph );
+    free( d_path );
+#endif // DEBUG
+
+    // collect the blocks following each divider in a bucket per flag and
+    // scope. A stmts divider starts a new scope if its scope is higher than
+    // all before.
+    utarray_new( scopes, &ut_int_icd );
+    lead_len = size;
+    for( line = buf; *line != '\0'; line = eol ) {
+        eol = strchr( line, '\n' );
+        eol = ( eol == NULL ) ? &buf[size] : eol + 1;
+        flag = *eol;
+        *eol = '\0';
+        ptr = strstr( line, DOT_PATTERN );
+        *eol = flag;
+        if( ptr != NULL ) {
+            // found an occurrence of the pattern
+            ptr += sizeof( DOT_PATTERN ) - 1;
+            flag = *ptr;
+            scope = atoi( ptr + 1 );
+            if( block_cnt == 0 ) lead_len = line - buf;
+            if( ( flag == FLAG_STMTS ) && ( scope > last_scope ) ) {
+                last_scope = scope;
+                utarray_push_back( scopes, &scope );
+            }
+            bucket = graph_fix_dot_bucket( &buckets, flag, scope );
+            block = malloc( sizeof( dot_block_t ) );
+            block->text = eol;
+            block->len = 0;
+            block->idx = block_cnt++;
+            block->next = NULL;
+            if( bucket->last == NULL ) bucket->first = block;
+            else bucket->last->next = block;
+            bucket->last = block;
+        }
+        else if( block != NULL ) {
+            block->len += eol - line;
+        }
+    }
+
+    // the text before the first divider is written once, followed by the
+    // blocks of each scope in the order of the flags
+    r_graph = fopen( r_path, "w" );
+    fwrite( buf, 1, lead_len, r_graph );
     while( !done ) {
-        r_graph = fopen( r_path, "r" );
-        while( fgets( str, 512, r_graph ) ) {
-            ptr = strstr( str, pattern );
-            if( ptr != NULL ) {
-                // found an occurrence of the pattern
-                copy = false;
-                ptr += sizeof( DOT_PATTERN ) - 1;
-                flag = *ptr;
-                ptr++;
-                scope = atoi(ptr);
-                switch( flag ) {
-                    case FLAG_STMTS:
-                        if( scope <= last_scope ) continue;
-                        if( flag != next_flag ) continue;
-                        last_scope = scope;
-                        next_flag = FLAG_WRAP_PRE;
-                        copy = true;
-                        break;
-                    case FLAG_WRAP:
-                        if( scope != last_scope ) continue;
-                        if( flag != next_flag ) continue;
+        last = NULL;
+        switch( next_flag ) {
+            case FLAG_STMTS:
+                scope_ptr = utarray_next( scopes, scope_ptr );
+                if( scope_ptr == NULL ) break;
+                last = graph_fix_dot_write( r_graph, buckets, FLAG_STMTS,
+                        *scope_ptr, -1, false );
+                // the pre wrapper blocks are only copied after the stmts
+                next_flag = FLAG_WRAP_PRE;
+                graph_fix_dot_write( r_graph, buckets, FLAG_WRAP_PRE,
+                        *scope_ptr, last->idx, true );
+                break;
+            case FLAG_WRAP:
+                // only the first wrapper of a scope is drawn
+                last = graph_fix_dot_write( r_graph, buckets, FLAG_WRAP,
+                        *scope_ptr, -1, false );
+                if( last == NULL ) break;
 #ifdef DOT_SYNC_FIRST
-                        next_flag = FLAG_CONNECT;
+                next_flag = FLAG_CONNECT;
 #else // DOT_SYNC_FIRST
-                        next_flag = FLAG_NET;
+                next_flag = FLAG_NET;
 #endif // DOT_SYNC_FIRST
-                        copy = true;
-                        break;
-                    case FLAG_WRAP_END:
-                    case FLAG_WRAP_PRE:
-                    case FLAG_STMTS_END:
-                    case FLAG_NET:
-                    case FLAG_CONNECT:
-                        if( scope != last_scope ) continue;
-                        if( flag != next_flag ) continue;
-                        copy = true;
-                        break;
-                    default:
-                        ;
-                }
-                /* printf( "flag: %c, scope: %d\n", flag, scope ); */
-            }
-            else if( copy ) {
-                fprintf( t_graph, "%s", str );
-            }
+                graph_fix_dot_write( r_graph, buckets, next_flag,
+                        *scope_ptr, last->idx, true );
+                break;
+            default:
+                last = graph_fix_dot_write( r_graph, buckets, next_flag,
+                        *scope_ptr, -1, true );
         }
         switch( next_flag ) {
             case FLAG_STMTS:
@@ -523,26 +595,64 @@ void graph_fix_dot( char* t_path, char* r_path )
             default:
                 ;
         }
-        fclose( r_graph );
-    }
-    fclose( t_graph );
-#if defined(DEBUG) || defined(DEBUG_GRAPH)
-    // save the original file in order to debug
-    sprintf( d_path, "%s.dbg", r_path );
-    r_graph = fopen( r_path, "r" );
-    d_graph = fopen( d_path, "w" );
-    while( fgets( str, 512, r_graph ) ) {
-        fprintf( d_graph, "%s", str );
     }
     fclose( r_graph );
-    fclose( d_graph );
-#endif // DEBUG
-    // copy the fixed dot file back to the original file
-    t_graph = fopen( t_path, "r" );
-    r_graph = fopen( r_path, "w" );
-    while( fgets( str, 512, t_graph ) ) {
-        fprintf( r_graph, "%s", str );
+
+    // cleanup
+    HASH_ITER( hh, buckets, bucket, tmp ) {
+        HASH_DEL( buckets, bucket );
+        for( block = bucket->first; block != NULL; block = block_next ) {
+            block_next = block->next;
+            free( block );
+        }
+        free( bucket );
+    }
+    utarray_free( scopes );
+    free( buf );
+}
+
+/******************************************************************************/
+dot_bucket_t* graph_fix_dot_bucket( dot_bucket_t** buckets, char flag,
+        int scope )
+{
+    dot_bucket_t* bucket;
+    dot_bucket_key_t key;
+
+    // the padding of the key is part of the hash
+    memset( &key, 0, sizeof( dot_bucket_key_t ) );
+    key.scope = scope;
+    key.flag = flag;
+    HASH_FIND( hh, *buckets, &key, sizeof( dot_bucket_key_t ), bucket );
+    if( bucket == NULL ) {
+        bucket = malloc( sizeof( dot_bucket_t ) );
+        memset( bucket, 0, sizeof( dot_bucket_t ) );
+        bucket->key = key;
+        HASH_ADD( hh, *buckets, key, sizeof( dot_bucket_key_t ), bucket );
+    }
+    return bucket;
+}
+
+/******************************************************************************/
+dot_block_t* graph_fix_dot_write( FILE* graph, dot_bucket_t* buckets,
+        char flag, int scope, int idx, bool all )
+{
+    dot_bucket_t* bucket;
+    dot_bucket_key_t key;
+    dot_block_t* block;
+    dot_block_t* last = NULL;
+
+    memset( &key, 0, sizeof( dot_bucket_key_t ) );
+    key.scope = scope;
+    key.flag = flag;
+    HASH_FIND( hh, buckets, &key, sizeof( dot_bucket_key_t ), bucket );
+    if( bucket == NULL ) return NULL;
+    for( block = bucket->first; block != NULL; block = block->next ) {
+        if( block->idx <= idx ) continue;
+        fwrite( block->text, 1, block->len, graph );
+        last = block;
+        if( !all ) break;
     }
+    return last;
 }
 #endif // DOT_CON
 
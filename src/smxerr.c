@@ -6,14 +6,127 @@
  *
  */
 
+#include <stdlib.h>
 #include <string.h>
 #include "smxerr.h"
 
-void report_yyerror( const char* msg, int line )
+#ifdef SMXC_THREADS
+pthread_mutex_t __smxc_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif // SMXC_THREADS
+
+extern int __smxc_max_errors;
+
+static diag_t* __diag_hash = NULL;      // all recorded messages, for lookup
+static diag_t* __diag_first = NULL;     // all recorded messages, in order
+static diag_t* __diag_last = NULL;
+static int __diag_error_cnt = 0;
+static int __diag_drop_cnt = 0;
+static bool __diag_drop_printed = false;
+
+/******************************************************************************/
+bool report_yyerror( const char* msg, int line )
 {
+    bool res;
+#ifdef SMXC_THREADS
+    pthread_mutex_lock( &__smxc_lock );
+#endif // SMXC_THREADS
     yylineno = line;
-    yynerrs++;
-    yyerror( NULL, msg );
+    res = smxerr_add_msg( msg );
+    if( res ) yynerrs++;
+#ifdef SMXC_THREADS
+    pthread_mutex_unlock( &__smxc_lock );
+#endif // SMXC_THREADS
+    return res;
+}
+
+/******************************************************************************/
+void report_note( const char* note )
+{
+    if( __diag_last == NULL || __diag_last->is_printed ) return;
+    free( __diag_last->note );
+    __diag_last->note = malloc( strlen( note ) + 1 );
+    strcpy( __diag_last->note, note );
+}
+
+/******************************************************************************/
+bool smxerr_add( const char* text, bool is_error )
+{
+    diag_t* diag;
+
+    HASH_FIND_STR( __diag_hash, text, diag );
+    if( diag != NULL ) return false;
+    if( ( __smxc_max_errors > 0 ) && ( __diag_error_cnt >= __smxc_max_errors ) ) {
+        __diag_drop_cnt++;
+        return false;
+    }
+    if( is_error ) __diag_error_cnt++;
+
+    diag = malloc( sizeof( diag_t ) );
+    diag->text = malloc( strlen( text ) + 1 );
+    strcpy( diag->text, text );
+    diag->note = NULL;
+    diag->is_printed = false;
+    diag->next = NULL;
+    HASH_ADD_KEYPTR( hh, __diag_hash, diag->text, strlen( diag->text ), diag );
+    if( __diag_last == NULL ) __diag_first = diag;
+    else __diag_last->next = diag;
+    __diag_last = diag;
+    return true;
+}
+
+/******************************************************************************/
+bool smxerr_add_msg( const char* s )
+{
+    char text[ strlen( __src_file_name ) + CONST_ID_LEN + strlen( s )
+        + strlen( yytext ) + 10 ];
+
+    if( strlen( yytext ) == 0 )
+        sprintf( text, "%s: %d: %s", __src_file_name, yylineno, s );
+    else
+        sprintf( text, "%s: %d: %s '%s'", __src_file_name, yylineno, s,
+                yytext );
+    return smxerr_add( text,
+            strncmp( s, ERR_WARNING, strlen( ERR_WARNING ) ) != 0 );
+}
+
+/******************************************************************************/
+void smxerr_destroy()
+{
+    diag_t* diag;
+    diag_t* tmp;
+
+    HASH_ITER( hh, __diag_hash, diag, tmp ) {
+        HASH_DEL( __diag_hash, diag );
+        free( diag->text );
+        free( diag->note );
+        free( diag );
+    }
+    __diag_first = NULL;
+    __diag_last = NULL;
+}
+
+/******************************************************************************/
+void smxerr_flush()
+{
+    diag_t* diag;
+
+    for( diag = __diag_first; diag != NULL; diag = diag->next ) {
+        if( diag->is_printed ) continue;
+        printf( "%s\n", diag->text );
+        if( diag->note != NULL ) printf( "%s", diag->note );
+        diag->is_printed = true;
+    }
+    if( ( __diag_drop_cnt > 0 ) && !__diag_drop_printed ) {
+        printf( "Too many errors, stopped after %d error(s)\n",
+                __smxc_max_errors );
+        __diag_drop_printed = true;
+    }
+}
+
+/******************************************************************************/
+bool smxerr_has_errors()
+{
+    return __diag_error_cnt > 0;
 }
 
 /*
@@ -23,8 +136,5 @@ void report_yyerror( const char* msg, int line )
  * */
 void yyerror( void** ast, const char* s ) {
     ( void )( ast );
-    if( strlen(yytext) == 0 )
-        printf( "%s: %d: %s\n", __src_file_name, yylineno, s );
-    else
-        printf( "%s: %d: %s '%s'\n", __src_file_name, yylineno, s, yytext );
+    smxerr_add_msg( s );
 }
@@ -7,12 +7,17 @@
  *
  */
 
+#include <math.h>
 #include "smxgraph.h"
 #include "defines.h"
 #include "insttab.h"
 #include "context.h"
+#include "smxerr.h"
 
 extern int __smxc_min_ch_len;
+extern int __smxc_jobs;
+
+int __farm_cnt = 0; // last id given to a farm of the flattened graph
 
 /******************************************************************************/
 void dgraph_append( igraph_t* g, igraph_t* g_tpl, bool deep )
@@ -85,6 +90,10 @@ int dgraph_edge_add( igraph_t* g, virt_port_t* p_src, virt_port_t* p_dest,
             p_src->rate.time.tv_sec, p_src->rate.time.tv_nsec,
             p_dest->rate.time.tv_sec, p_dest->rate.time.tv_nsec, type,
             p_src->is_dynamic, p_dest->is_dynamic );
+    // only set if declared, post_process_msg_size() fills in the others
+    if( get_msg_size( p_src, p_dest ) > 0 )
+        igraph_cattribute_EAN_set( g, GE_MSG_SIZE, id,
+                get_msg_size( p_src, p_dest ) );
     return id;
 }
 
@@ -113,6 +122,30 @@ void dgraph_edge_add_attr( igraph_t* g, int id, const char* name,
     igraph_cattribute_EAN_set( g, GE_DYNDST, id, is_dyn_dst );
 }
 
+/******************************************************************************/
+void dgraph_edge_update_ids( igraph_t* g )
+{
+    int eid;
+    igraph_es_t es;
+    igraph_eit_t eit;
+    virt_port_t *p_src, *p_dst;
+
+    es = igraph_ess_all( IGRAPH_EDGEORDER_ID );
+    igraph_eit_create( g, es, &eit );
+    while( !IGRAPH_EIT_END( eit ) ) {
+        eid = IGRAPH_EIT_GET( eit );
+        p_src = ( virt_port_t* )( uintptr_t ) igraph_cattribute_EAN( g,
+                GE_PSRC, eid );
+        p_dst = ( virt_port_t* )( uintptr_t ) igraph_cattribute_EAN( g,
+                GE_PDST, eid );
+        p_src->edge_id = eid;
+        p_dst->edge_id = eid;
+        IGRAPH_EIT_NEXT( eit );
+    }
+    igraph_eit_destroy( &eit );
+    igraph_es_destroy( &es );
+}
+
 /******************************************************************************/
 void dgraph_destroy_attr( igraph_t* g )
 {
@@ -152,59 +185,154 @@ void dgraph_destroy_attr_v( igraph_t* g, const char* attr )
         igraph_cattribute_remove_v( g, attr );
 }
 
+/******************************************************************************/
+int dgraph_farm_add()
+{
+    int farm;
+#ifdef SMXC_THREADS
+    pthread_mutex_lock( &__smxc_lock );
+#endif // SMXC_THREADS
+    farm = ++__farm_cnt;
+#ifdef SMXC_THREADS
+    pthread_mutex_unlock( &__smxc_lock );
+#endif // SMXC_THREADS
+    return farm;
+}
+
 /******************************************************************************/
 void dgraph_flatten( igraph_t* g_new, igraph_t* g )
+{
+    // the farms of the top-level net are numbered like those of net instances
+    dgraph_vertex_update_farms( g, &__farm_cnt );
+    dgraph_flatten_graph( g, __smxc_jobs );
+    dgraph_append( g_new, g, false );
+#if defined(DEBUG) || defined(DEBUG_FLATTEN_GRAPH)
+    igraph_write_graph_dot( g_new, stdout );
+#endif // DEBUG_FLATTEN_GRAPH
+}
+
+/******************************************************************************/
+void dgraph_flatten_child( flatten_job_t* job )
+{
+    igraph_t* g_tmp;
+
+    g_tmp = ( igraph_t* )( uintptr_t )igraph_cattribute_VAN( job->g_in,
+            GV_GRAPH, job->inst_id );
+    job->is_ready = true;
+    if( igraph_vcount( g_tmp ) == 0 ) {
+        // something went wrong
+        job->is_valid = false;
+        return;
+    }
+    job->is_valid = true;
+    // deep copy child graph to create new instances
+    igraph_empty( &job->g_child, 0, IGRAPH_DIRECTED );
+    dgraph_append( &job->g_child, g_tmp, true );
+    // propagate attributes static and tt
+    dgraph_vertex_propagate_attrs( job->g_in, &job->g_child, job->inst_id );
+    // recoursively flatten further net instances
+    dgraph_flatten_graph( &job->g_child, 1 );
+}
+
+/******************************************************************************/
+void dgraph_flatten_graph( igraph_t* g, int thread_cnt )
 {
     igraph_vs_t vs;
     igraph_vit_t vit;
     virt_net_t* v_net_i;
-    igraph_t g_child, g_in, *g_tmp;
-    int inst_id;
+    igraph_t g_in;
+    flatten_job_t* jobs;
+    int inst_id, job_cnt = 0, i;
 
     igraph_copy( &g_in, g );
+    jobs = malloc( sizeof( flatten_job_t ) * ( igraph_vcount( &g_in ) + 1 ) );
     vs = igraph_vss_all();
     igraph_vit_create( &g_in, vs, &vit );
-    // iterate through all net instances of the graph
+    // collect all net instances of the graph
     while( !IGRAPH_VIT_END( vit ) ) {
         inst_id = IGRAPH_VIT_GET( vit );
         v_net_i = ( virt_net_t* )( uintptr_t )igraph_cattribute_VAN( &g_in,
                 GV_VNET, inst_id );
         if( ( v_net_i->type == VNET_NET ) || ( v_net_i->type == VNET_WRAP ) ) {
-#if defined(DEBUG) || defined(DEBUG_FLATTEN_GRAPH)
-            printf( "\nFlatten instance '%s(%d)' start\n", v_net_i->inst->name,
-                    v_net_i->inst->id );
-#endif // DEBUG_FLATTEN_GRAPH
-            g_tmp = ( igraph_t* )( uintptr_t )igraph_cattribute_VAN( &g_in,
-                    GV_GRAPH, inst_id );
-            if( igraph_vcount( g_tmp ) == 0 ) {
-                // something went wrong
-                IGRAPH_VIT_NEXT( vit );
-                continue;
-            }
-            // deep copy child graph to create new instances
-            igraph_empty( &g_child, 0, IGRAPH_DIRECTED );
-            dgraph_append( &g_child, g_tmp, true );
-            // propagate attributes static and tt
-            dgraph_vertex_propagate_attrs( &g_in, &g_child, inst_id );
-            // recoursively flatten further net instances
-            dgraph_flatten( g, &g_child );
-            dgraph_flatten_net( g, &g_child, v_net_i );
-            dgraph_vertex_remove( g, v_net_i->inst->id );
-#if defined(DEBUG) || defined(DEBUG_FLATTEN_GRAPH)
-            printf( "Flatten instance end\n\n" );
-#endif // DEBUG_FLATTEN_GRAPH
-            igraph_destroy( &g_child );
+            jobs[job_cnt].g_in = &g_in;
+            jobs[job_cnt].inst_id = inst_id;
+            jobs[job_cnt].is_ready = false;
+            job_cnt++;
         }
         IGRAPH_VIT_NEXT( vit );
     }
     igraph_vit_destroy( &vit );
     igraph_vs_destroy( &vs );
-    dgraph_append( g_new, g, false );
-    igraph_destroy( &g_in );
+
+#ifdef SMXC_THREADS
+    // the child graphs are independent of each other: prepare them
+    // concurrently and splice them in the order of the instances below
+    if( ( thread_cnt > 1 ) && ( job_cnt > 1 ) )
+        dgraph_flatten_pool( jobs, job_cnt, thread_cnt );
+#else
+    ( void )thread_cnt;
+#endif // SMXC_THREADS
+
+    for( i = 0; i < job_cnt; i++ ) {
+        v_net_i = ( virt_net_t* )( uintptr_t )igraph_cattribute_VAN( &g_in,
+                GV_VNET, jobs[i].inst_id );
 #if defined(DEBUG) || defined(DEBUG_FLATTEN_GRAPH)
-    igraph_write_graph_dot( g_new, stdout );
+        printf( "\nFlatten instance '%s(%d)' start\n", v_net_i->inst->name,
+                v_net_i->inst->id );
 #endif // DEBUG_FLATTEN_GRAPH
+        if( !jobs[i].is_ready ) dgraph_flatten_child( &jobs[i] );
+        if( !jobs[i].is_valid ) continue;
+        // splice the child graph into the graph
+        dgraph_append( g, &jobs[i].g_child, false );
+        dgraph_flatten_net( g, &jobs[i].g_child, v_net_i );
+        dgraph_vertex_remove( g, v_net_i->inst->id );
+#if defined(DEBUG) || defined(DEBUG_FLATTEN_GRAPH)
+        printf( "Flatten instance end\n\n" );
+#endif // DEBUG_FLATTEN_GRAPH
+        igraph_destroy( &jobs[i].g_child );
+    }
+    free( jobs );
+    igraph_destroy( &g_in );
+}
+
+#ifdef SMXC_THREADS
+/******************************************************************************/
+void dgraph_flatten_pool( flatten_job_t* jobs, int job_cnt, int thread_cnt )
+{
+    flatten_pool_t pool;
+    pthread_t* threads;
+    int i;
+
+    if( thread_cnt > job_cnt ) thread_cnt = job_cnt;
+    pool.jobs = jobs;
+    pool.job_cnt = job_cnt;
+    pool.next = 0;
+    pthread_mutex_init( &pool.lock, NULL );
+    threads = malloc( sizeof( pthread_t ) * thread_cnt );
+    for( i = 0; i < thread_cnt; i++ )
+        pthread_create( &threads[i], NULL, dgraph_flatten_worker, &pool );
+    for( i = 0; i < thread_cnt; i++ )
+        pthread_join( threads[i], NULL );
+    free( threads );
+    pthread_mutex_destroy( &pool.lock );
+}
+
+/******************************************************************************/
+void* dgraph_flatten_worker( void* arg )
+{
+    flatten_pool_t* pool = arg;
+    int idx;
+
+    while( true ) {
+        pthread_mutex_lock( &pool->lock );
+        idx = pool->next++;
+        pthread_mutex_unlock( &pool->lock );
+        if( idx >= pool->job_cnt ) break;
+        dgraph_flatten_child( &pool->jobs[idx] );
+    }
+    return NULL;
 }
+#endif // SMXC_THREADS
 
 /******************************************************************************/
 void dgraph_flatten_net( igraph_t* g_new, igraph_t* g_child, virt_net_t* v_net )
@@ -275,6 +403,13 @@ void dgraph_flatten_net( igraph_t* g_new, igraph_t* g_child, virt_net_t* v_net )
     igraph_destroy( &g );
 }
 
+/******************************************************************************/
+void dgraph_merge_mark_clear( igraph_t* g )
+{
+    if( igraph_cattribute_has_attr( g, IGRAPH_ATTRIBUTE_GRAPH, GG_MERGE_ECNT ) )
+        igraph_cattribute_remove_g( g, GG_MERGE_ECNT );
+}
+
 /******************************************************************************/
 virt_port_t* dgraph_port_search_neighbour( igraph_t* g, igraph_t* g_new,
         int id_edge, int id_inst, const char* attr )
@@ -360,6 +495,17 @@ void dgraph_vertex_add_attr( igraph_t* g, int id, const char* func,
     igraph_cattribute_VAN_set( g, GV_TT, id, false );
 }
 
+/******************************************************************************/
+void dgraph_vertex_add_attr_path( igraph_t* g, int id, const char* name,
+        int line )
+{
+    char* path = malloc( strlen( name ) + CONST_ID_LEN + 2 );
+    if( line < 0 ) strcpy( path, name );
+    else sprintf( path, "%s@%d", name, line );
+    igraph_cattribute_VAS_set( g, GV_PATH, id, path );
+    free( path );
+}
+
 /******************************************************************************/
 void dgraph_vertex_add_attr_tt( igraph_t* g, int id, int attr_tt )
 {
@@ -375,6 +521,7 @@ virt_net_t* dgraph_vertex_add_box( igraph_t* g, symrec_t* symb, int line )
     dgraph_vertex_add_attr( g, id, symb->attr_box->impl_name, symb, v_net,
             NULL, false, symb->attr_box->attr_pure,
             symb->attr_box->attr_location );
+    dgraph_vertex_add_attr_path( g, id, symb->name, line );
     return v_net;
 }
 
@@ -386,6 +533,7 @@ virt_net_t* dgraph_vertex_add_net( igraph_t* g, symrec_t* symb, int line )
     virt_net_t* v_net = virt_net_create_net( symb->attr_net->v_net, inst );
     dgraph_vertex_add_attr( g, id, NULL, symb, v_net, &symb->attr_net->g,
             false, false, false );
+    dgraph_vertex_add_attr_path( g, id, symb->name, line );
     return v_net;
 }
 
@@ -397,6 +545,7 @@ virt_net_t* dgraph_vertex_add_sync( igraph_t* g, const char* name )
     virt_net_t* v_net = virt_net_create_sync( inst );
     dgraph_vertex_add_attr( g, id, name, NULL, v_net, NULL, false, false,
             false );
+    dgraph_vertex_add_attr_path( g, id, name, -1 );
     return v_net;
 }
 
@@ -408,6 +557,7 @@ virt_net_t* dgraph_vertex_add_wrap( igraph_t* g, symrec_t* symb, int line )
     virt_net_t* v_net = virt_net_create_wrap( symb, inst );
     dgraph_vertex_add_attr( g, id, NULL, symb, v_net, &symb->attr_wrap->g,
             symb->attr_wrap->attr_static, false, false );
+    dgraph_vertex_add_attr_path( g, id, symb->name, line );
     return v_net;
 }
 
@@ -466,6 +616,23 @@ instrec_t* dgraph_vertex_copy( igraph_t* g_src, igraph_t* g_dest, int id,
                 GV_TT ) )
         igraph_cattribute_VAN_set( g_dest, GV_TT, new_id,
             igraph_cattribute_VAN( g_src, GV_TT, id ) );
+    if( igraph_cattribute_has_attr( g_src, IGRAPH_ATTRIBUTE_VERTEX,
+                GV_PATH ) )
+        igraph_cattribute_VAS_set( g_dest, GV_PATH, new_id,
+            igraph_cattribute_VAS( g_src, GV_PATH, id ) );
+    // add the farm attrs if the vertex is part of a farm
+    if( dgraph_vertex_is_farm( g_src, id ) ) {
+        igraph_cattribute_VAN_set( g_dest, GV_FARM, new_id,
+            dgraph_vertex_get_farm( g_src, id, GV_FARM ) );
+        igraph_cattribute_VAN_set( g_dest, GV_REPLICA, new_id,
+            dgraph_vertex_get_farm( g_src, id, GV_REPLICA ) );
+        igraph_cattribute_VAN_set( g_dest, GV_FARM_OUTER, new_id,
+            dgraph_vertex_get_farm( g_src, id, GV_FARM_OUTER ) );
+        igraph_cattribute_VAN_set( g_dest, GV_REPLICA_OUTER, new_id,
+            dgraph_vertex_get_farm( g_src, id, GV_REPLICA_OUTER ) );
+        igraph_cattribute_VAN_set( g_dest, GV_FARM_RN, new_id,
+            dgraph_vertex_get_farm( g_src, id, GV_FARM_RN ) );
+    }
     return inst;
 }
 
@@ -479,6 +646,43 @@ void dgraph_vertex_destroy_attr( igraph_t* g, int id, bool deep )
     virt_net_destroy( v_net, deep );
 }
 
+/******************************************************************************/
+int dgraph_vertex_get_farm( igraph_t* g, int id, const char* name )
+{
+    double val;
+    if( !igraph_cattribute_has_attr( g, IGRAPH_ATTRIBUTE_VERTEX, name ) )
+        return 0;
+    // vertices added before or after the first farm hold NaN
+    val = igraph_cattribute_VAN( g, name, id );
+    if( isnan( val ) ) return 0;
+    return val;
+}
+
+/******************************************************************************/
+void dgraph_vertex_init_farm( igraph_t* g, int id )
+{
+    const char* attrs[] = { GV_FARM, GV_REPLICA, GV_FARM_OUTER,
+        GV_REPLICA_OUTER, GV_FARM_RN };
+    int i;
+
+    // vertices which are not part of a farm hold NaN
+    for( i = 0; i < 5; i++ )
+        igraph_cattribute_VAN_set( g, attrs[i], id,
+                dgraph_vertex_get_farm( g, id, attrs[i] ) );
+}
+
+/******************************************************************************/
+bool dgraph_vertex_is_farm( igraph_t* g, int id )
+{
+    return dgraph_vertex_get_farm( g, id, GV_FARM ) > 0;
+}
+
+/******************************************************************************/
+bool dgraph_vertex_is_farm_rn( igraph_t* g, int id )
+{
+    return dgraph_vertex_get_farm( g, id, GV_FARM_RN ) != FARM_RN_NONE;
+}
+
 /******************************************************************************/
 int dgraph_vertex_merge( igraph_t* g, int id1, int id2 )
 {
@@ -510,8 +714,15 @@ int dgraph_vertex_merge( igraph_t* g, int id1, int id2 )
             GV_PURE, IGRAPH_ATTRIBUTE_COMBINE_FIRST,
             GV_LOCATION, IGRAPH_ATTRIBUTE_COMBINE_FIRST,
             GV_TT, IGRAPH_ATTRIBUTE_COMBINE_FIRST,
+            GV_FARM, IGRAPH_ATTRIBUTE_COMBINE_FIRST,
+            GV_REPLICA, IGRAPH_ATTRIBUTE_COMBINE_FIRST,
+            GV_FARM_OUTER, IGRAPH_ATTRIBUTE_COMBINE_FIRST,
+            GV_REPLICA_OUTER, IGRAPH_ATTRIBUTE_COMBINE_FIRST,
+            GV_FARM_RN, IGRAPH_ATTRIBUTE_COMBINE_FIRST,
+            GV_PATH, IGRAPH_ATTRIBUTE_COMBINE_FIRST,
             IGRAPH_NO_MORE_ATTRIBUTES );
     igraph_contract_vertices( g, &v_new, &comb );
+    dgraph_merge_mark_clear( g );
     igraph_attribute_combination_destroy( &comb );
     igraph_vector_destroy( &v_new );
 
@@ -531,6 +742,20 @@ void dgraph_vertex_propagate_attrs( igraph_t* g_in, igraph_t* g, int id )
     igraph_vit_t vit;
     int v_static = igraph_cattribute_VAN( g_in, GV_STATIC, id );
     int v_tt = igraph_cattribute_VAN( g_in, GV_TT, id );
+    int v_farm = dgraph_vertex_get_farm( g_in, id, GV_FARM );
+    int v_replica = dgraph_vertex_get_farm( g_in, id, GV_REPLICA );
+    int v_farm_outer = dgraph_vertex_get_farm( g_in, id, GV_FARM_OUTER );
+    int v_replica_outer = dgraph_vertex_get_farm( g_in, id, GV_REPLICA_OUTER );
+    const char* v_path = igraph_cattribute_VAS( g_in, GV_PATH, id );
+    char* path;
+    // each instance of a net gets its own farms
+#ifdef SMXC_THREADS
+    pthread_mutex_lock( &__smxc_lock );
+#endif // SMXC_THREADS
+    dgraph_vertex_update_farms( g, &__farm_cnt );
+#ifdef SMXC_THREADS
+    pthread_mutex_unlock( &__smxc_lock );
+#endif // SMXC_THREADS
     vs = igraph_vss_all();
     igraph_vit_create( g, vs, &vit );
     while( !IGRAPH_VIT_END( vit ) ) {
@@ -539,6 +764,28 @@ void dgraph_vertex_propagate_attrs( igraph_t* g_in, igraph_t* g, int id )
             igraph_cattribute_VAN_set( g, GV_STATIC, vid, v_static );
         if( v_tt )
             igraph_cattribute_VAN_set( g, GV_TT, vid, v_tt );
+        if( v_farm && !dgraph_vertex_is_farm( g, vid ) ) {
+            // a net replicated by a farm passes its replica on to all of its
+            // vertices which are not part of a farm of their own
+            igraph_cattribute_VAN_set( g, GV_FARM, vid, v_farm );
+            igraph_cattribute_VAN_set( g, GV_REPLICA, vid, v_replica );
+            igraph_cattribute_VAN_set( g, GV_FARM_OUTER, vid, v_farm_outer );
+            igraph_cattribute_VAN_set( g, GV_REPLICA_OUTER, vid,
+                    v_replica_outer );
+        }
+        else if( v_farm
+                && ( dgraph_vertex_get_farm( g, vid, GV_FARM_OUTER ) == 0 ) ) {
+            // a farm of the net is nested in the farm of the net instance
+            igraph_cattribute_VAN_set( g, GV_FARM_OUTER, vid, v_farm );
+            igraph_cattribute_VAN_set( g, GV_REPLICA_OUTER, vid, v_replica );
+        }
+        // prefix the instance path with the path of the net
+        path = malloc( strlen( v_path )
+                + strlen( igraph_cattribute_VAS( g, GV_PATH, vid ) ) + 2 );
+        sprintf( path, "%s/%s", v_path,
+                igraph_cattribute_VAS( g, GV_PATH, vid ) );
+        igraph_cattribute_VAS_set( g, GV_PATH, vid, path );
+        free( path );
         IGRAPH_VIT_NEXT( vit );
     }
     igraph_vit_destroy( &vit );
@@ -556,9 +803,35 @@ void dgraph_vertex_remove( igraph_t* g, int id )
     vs = igraph_vss_1( id );
     igraph_delete_vertices( g, vs );
     igraph_vs_destroy( &vs );
+    dgraph_merge_mark_clear( g );
     dgraph_vertex_update_ids( g, id );
 }
 
+/******************************************************************************/
+void dgraph_vertex_update_farms( igraph_t* g, int* farm_cnt )
+{
+    const char* attrs[] = { GV_FARM_OUTER, GV_FARM };
+    int vid, i, farm, farm_max = 0;
+    int* farm_new;
+
+    if( !igraph_cattribute_has_attr( g, IGRAPH_ATTRIBUTE_VERTEX, GV_FARM ) )
+        return;
+    for( vid = 0; vid < igraph_vcount( g ); vid++ )
+        for( i = 0; i < 2; i++ ) {
+            farm = dgraph_vertex_get_farm( g, vid, attrs[i] );
+            if( farm > farm_max ) farm_max = farm;
+        }
+    farm_new = calloc( farm_max + 1, sizeof( int ) );
+    for( vid = 0; vid < igraph_vcount( g ); vid++ )
+        for( i = 0; i < 2; i++ ) {
+            farm = dgraph_vertex_get_farm( g, vid, attrs[i] );
+            if( farm == 0 ) continue;
+            if( farm_new[farm] == 0 ) farm_new[farm] = ++( *farm_cnt );
+            igraph_cattribute_VAN_set( g, attrs[i], vid, farm_new[farm] );
+        }
+    free( farm_new );
+}
+
 /******************************************************************************/
 void dgraph_vertex_update_ids( igraph_t* g, int id_start )
 {
@@ -614,7 +887,8 @@ void dgraph_wrap_sync_create( igraph_t* g, igraph_vector_ptr_t* syncs,
             vp_new = virt_port_create( vp_net->attr_class, vp_net->attr_mode,
                     vp_net->v_net, vp_net->name, vp_net->symb,
                     vp_net->rate.time, vp_net->rate.type, vp_net->descoupled,
-                    vp_net->is_open, vp_net->is_dynamic, vp_net->ch_len );
+                    vp_net->is_open, vp_net->is_dynamic, vp_net->ch_len,
+                    vp_net->msg_size );
             virt_port_append( v_net, vp_new );
         }
         else {
@@ -629,7 +903,7 @@ void dgraph_wrap_sync_create( igraph_t* g, igraph_vector_ptr_t* syncs,
                 vp_net = virt_port_create( sp_src->attr_port->collection,
                         sp_src->attr_port->mode, cp_sync, sp_src->name,
                         sp_src, tb, TIME_NONE, sp_src->attr_port->decoupled,
-                        false, false, 0 );
+                        false, false, 0, sp_src->attr_port->msg_size );
                 virt_port_append( v_net, vp_net );
                 virt_port_append( cp_sync, virt_port_copy( vp_net ) );
             }
@@ -654,7 +928,7 @@ void dgraph_wrap_sync_create( igraph_t* g, igraph_vector_ptr_t* syncs,
                     mode = PORT_MODE_OUT;
                 vp_new = virt_port_create( vp_net->attr_class, mode, cp_sync,
                         vp_net->name, vp_net->symb, tb, TIME_NONE,
-                        false, false, false, 0 );
+                        false, false, false, 0, vp_net->msg_size );
                 virt_port_append( cp_sync, vp_new );
                 // unknown direction, ignore class, modes have to be equal
                 check_connection( vp_new, vp_net, g, false, true, true );
@@ -672,19 +946,9 @@ int get_ch_len( virt_port_t* p1, virt_port_t* p2 )
 }
 
 /******************************************************************************/
-bool is_wrap_sync_merge_int( igraph_vector_ptr_t* v1, igraph_vector_ptr_t* v2 )
+int get_msg_size( virt_port_t* p1, virt_port_t* p2 )
 {
-    symrec_t* p1 = NULL;
-    symrec_t* p2 = NULL;
-    int i = 0, j = 0;
-    for( i = 0; i < igraph_vector_ptr_size( v1 ); i++ ) {
-        p1 = VECTOR( *v1 )[i];
-        for( j = 0; j < igraph_vector_ptr_size( v2 ); j++ ) {
-            p2 = VECTOR( *v2 )[j];
-            if( strcmp( p1->name, p2->name ) == 0 ) return true;
-        }
-    }
-    return false;
+    return ( p1->msg_size > p2->msg_size ) ? p1->msg_size : p2->msg_size;
 }
 
 /******************************************************************************/
@@ -707,7 +971,7 @@ virt_net_t* wrap_connect_int( symrec_list_t* wrap_ports, virt_net_t* v_net_n,
     debug_print_syncs( &syncs );
 #endif // DEBUG
 
-    v_net = malloc( sizeof( virt_net_t ) );
+    v_net = virt_net_create();
     v_net->type = VNET_NET;
     v_net->inst = NULL;
     v_net->con = NULL;
@@ -759,47 +1023,110 @@ void wrap_sync_init( igraph_vector_ptr_t* syncs, symrec_list_t* sps_src )
 /******************************************************************************/
 void wrap_sync_merge( igraph_vector_ptr_t* syncs )
 {
-    sync_t* sync1 = NULL;
-    sync_t* sync2 = NULL;
-    int i = 0, j = 0;
-    for( i = 0; i < igraph_vector_ptr_size( syncs ); i++ ) {
-        sync1 = VECTOR( *syncs )[i];
-        for( j = i + 1; j < igraph_vector_ptr_size( syncs ); j++ ) {
-            sync2 = VECTOR( *syncs )[j];
-            if( is_wrap_sync_merge_int( &sync1->p_int, &sync2->p_int ) ) {
-                wrap_sync_merge_port( &sync1->p_int, &sync2->p_int, true );
-                wrap_sync_merge_port( &sync1->p_ext, &sync2->p_ext, false );
-                igraph_vector_ptr_remove( syncs, j );
-                igraph_vector_ptr_destroy( &sync2->p_int );
-                igraph_vector_ptr_destroy( &sync2->p_ext );
-                free( sync2 );
-                if( i > 0 ) i--;
-                j--;
+    sync_t* sync = NULL;
+    sync_t* sync_merge = NULL;
+    symrec_t* port = NULL;
+    sync_name_t* names = NULL;
+    sync_name_t* name = NULL;
+    sync_name_t* tmp = NULL;
+    igraph_heap_min_t candidates;
+    int sync_count = igraph_vector_ptr_size( syncs );
+    int* prev = malloc( sizeof( int ) * ( sync_count + 1 ) );
+    int* next = malloc( sizeof( int ) * ( sync_count + 1 ) );
+    int i = 0, j = 0, k = 0, idx = 0, cursor = 0, merge_cnt = 0, scan = 0,
+        cnt = 0;
+
+    // hash each internal port name with the syncs holding it. The syncs which
+    // were not absorbed are linked in order.
+    for( i = 0; i < sync_count; i++ ) {
+        prev[i] = i - 1;
+        next[i] = ( i < sync_count - 1 ) ? i + 1 : -1;
+        sync = VECTOR( *syncs )[i];
+        for( j = 0; j < igraph_vector_ptr_size( &sync->p_int ); j++ ) {
+            port = VECTOR( sync->p_int )[j];
+            HASH_FIND_STR( names, port->name, name );
+            if( name == NULL ) {
+                name = malloc( sizeof( sync_name_t ) );
+                name->name = port->name;
+                igraph_vector_init( &name->syncs, 0 );
+                name->scan = -1;
+                HASH_ADD_KEYPTR( hh, names, name->name, strlen( name->name ),
+                        name );
             }
+            igraph_vector_push_back( &name->syncs, i );
         }
     }
-}
 
-/******************************************************************************/
-void wrap_sync_merge_port( igraph_vector_ptr_t* v1, igraph_vector_ptr_t* v2,
-        bool check_name )
-{
-    symrec_t* p1 = NULL;
-    symrec_t* p2 = NULL;
-    bool add = true;
-    int i = 0, j = 0;
-    for( i = 0; i < igraph_vector_ptr_size( v2 ); i++ ) {
-        add = true;
-        p2 = VECTOR( *v2 )[i];
-        for( j = 0; j < igraph_vector_ptr_size( v1 ); j++ ) {
-            p1 = VECTOR( *v1 )[j];
-            if( check_name && ( strcmp( p1->name, p2->name ) == 0 ) ) {
-                add = false;
-                break;
+    igraph_heap_min_init( &candidates, 0 );
+    i = ( sync_count > 0 ) ? 0 : -1;
+    while( i >= 0 ) {
+        // a sync absorbs the following syncs which share a name with it, in
+        // order: collect the syncs holding one of its names
+        sync = VECTOR( *syncs )[i];
+        cursor = i;
+        merge_cnt = 0;
+        for( j = 0; j < igraph_vector_ptr_size( &sync->p_int ); j++ ) {
+            port = VECTOR( sync->p_int )[j];
+            HASH_FIND_STR( names, port->name, name );
+            if( name->scan == scan ) continue;
+            name->scan = scan;
+            for( k = 0; k < igraph_vector_size( &name->syncs ); k++ )
+                if( VECTOR( name->syncs )[k] > cursor )
+                    igraph_heap_min_push( &candidates,
+                            VECTOR( name->syncs )[k] );
+        }
+        while( !igraph_heap_min_empty( &candidates ) ) {
+            idx = ( int )igraph_heap_min_delete_top( &candidates );
+            if( ( idx <= cursor ) || ( VECTOR( *syncs )[idx] == NULL ) )
+                continue;
+            cursor = idx;
+            sync_merge = VECTOR( *syncs )[idx];
+            // new names are added once and may absorb further syncs
+            for( j = 0; j < igraph_vector_ptr_size( &sync_merge->p_int );
+                    j++ ) {
+                port = VECTOR( sync_merge->p_int )[j];
+                HASH_FIND_STR( names, port->name, name );
+                if( name->scan == scan ) continue;
+                name->scan = scan;
+                igraph_vector_ptr_push_back( &sync->p_int, port );
+                for( k = 0; k < igraph_vector_size( &name->syncs ); k++ )
+                    if( VECTOR( name->syncs )[k] > cursor )
+                        igraph_heap_min_push( &candidates,
+                                VECTOR( name->syncs )[k] );
+                igraph_vector_push_back( &name->syncs, i );
             }
+            for( j = 0; j < igraph_vector_ptr_size( &sync_merge->p_ext ); j++ )
+                igraph_vector_ptr_push_back( &sync->p_ext,
+                        VECTOR( sync_merge->p_ext )[j] );
+            igraph_vector_ptr_destroy( &sync_merge->p_int );
+            igraph_vector_ptr_destroy( &sync_merge->p_ext );
+            free( sync_merge );
+            VECTOR( *syncs )[idx] = NULL;
+            next[prev[idx]] = next[idx];
+            if( next[idx] >= 0 ) prev[next[idx]] = prev[idx];
+            merge_cnt++;
         }
-        if( add ) igraph_vector_ptr_push_back( v1, p2 );
+        // step back by one sync per absorbed sync, as the preceding syncs may
+        // now share a name with this one, but never before the first sync
+        for( j = 0; ( j < merge_cnt ) && ( prev[i] >= 0 ); j++ ) i = prev[i];
+        i = next[i];
+        scan++;
+    }
+
+    // remove the absorbed syncs from the vector
+    for( i = 0; i < sync_count; i++ )
+        if( VECTOR( *syncs )[i] != NULL )
+            VECTOR( *syncs )[cnt++] = VECTOR( *syncs )[i];
+    igraph_vector_ptr_resize( syncs, cnt );
+
+    HASH_ITER( hh, names, name, tmp ) {
+        HASH_DEL( names, name );
+        igraph_vector_destroy( &name->syncs );
+        free( name );
     }
+    igraph_heap_min_destroy( &candidates );
+    free( prev );
+    free( next );
 }
 
 /******************************************************************************/
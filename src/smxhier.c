@@ -0,0 +1,524 @@
+/**
+ * Hierarchical (non-flattened) output of the dependency graph
+ *
+ * @file    smxhier.c
+ * @author  Simon Maurer
+ *
+ */
+
+#include "smxhier.h"
+#include "context.h"
+#include "defines.h"
+#include "smxgraph.h"
+#include "smxz.h"
+
+/******************************************************************************/
+void smxhier_destroy( hier_t* hier )
+{
+    tpl_t* tpl;
+    tpl_t* tmp;
+
+    HASH_ITER( hh, hier->tpls, tpl, tmp ) {
+        HASH_DEL( hier->tpls, tpl );
+        igraph_destroy( &tpl->g );
+        free( tpl->name );
+        free( tpl );
+    }
+    igraph_destroy( &hier->g );
+}
+
+/******************************************************************************/
+void smxhier_dot_collapse( igraph_t* g, igraph_t* g_out )
+{
+    igraph_attribute_combination_t comb;
+    char label[CONST_ID_LEN];
+    int eid;
+
+    igraph_copy( g_out, g );
+    // the edges of a graph which is already collapsed keep their count
+    if( !igraph_cattribute_has_attr( g_out, IGRAPH_ATTRIBUTE_EDGE, GE_COUNT ) )
+        for( eid = 0; eid < igraph_ecount( g_out ); eid++ )
+            igraph_cattribute_EAN_set( g_out, GE_COUNT, eid, 1 );
+    igraph_attribute_combination( &comb,
+            GE_COUNT, IGRAPH_ATTRIBUTE_COMBINE_SUM,
+            "", IGRAPH_ATTRIBUTE_COMBINE_IGNORE,
+            IGRAPH_NO_MORE_ATTRIBUTES );
+    igraph_simplify( g_out, true, false, &comb );
+    igraph_attribute_combination_destroy( &comb );
+    for( eid = 0; eid < igraph_ecount( g_out ); eid++ ) {
+        sprintf( label, "%d",
+                ( int )igraph_cattribute_EAN( g_out, GE_COUNT, eid ) );
+        igraph_cattribute_EAS_set( g_out, GE_LABEL, eid, label );
+    }
+}
+
+/******************************************************************************/
+void smxhier_dot_expand( hier_t* hier, igraph_t* g, igraph_t* g_out )
+{
+    int vid, tid, eid, i, base, src, dst;
+    int v_cnt;
+    const char* name;
+    const char* label;
+    char* ports;
+    char* port;
+    char* save;
+    char* port_name;
+    char mode[4];
+    char* path;
+    tpl_t* tpl;
+    igraph_t* g_tpl;
+    igraph_integer_t from, to;
+    igraph_vector_t eids;
+    igraph_vector_t nets;
+    igraph_es_t es;
+    igraph_vs_t vs;
+    bool has_tpl = igraph_cattribute_has_attr( g, IGRAPH_ATTRIBUTE_VERTEX,
+            GV_TEMPLATE );
+
+    // a lean copy of the view, the net instances are expanded in place
+    igraph_empty( g_out, igraph_vcount( g ), IGRAPH_DIRECTED );
+    for( vid = 0; vid < igraph_vcount( g ); vid++ ) {
+        label = igraph_cattribute_VAS( g, GV_LABEL, vid );
+        path = malloc( strlen( label ) + CONST_ID_LEN + 2 );
+        sprintf( path, "%s_%d", label, vid );
+        igraph_cattribute_VAS_set( g_out, GV_LABEL, vid, label );
+        igraph_cattribute_VAS_set( g_out, GV_PATH, vid, path );
+        igraph_cattribute_VAS_set( g_out, GV_TEMPLATE, vid, has_tpl
+                ? igraph_cattribute_VAS( g, GV_TEMPLATE, vid ) : "" );
+        free( path );
+    }
+    for( eid = 0; eid < igraph_ecount( g ); eid++ ) {
+        igraph_edge( g, eid, &from, &to );
+        igraph_add_edge( g_out, from, to );
+        igraph_cattribute_EAS_set( g_out, GE_LABEL, eid,
+                igraph_cattribute_EAS( g, GE_LABEL, eid ) );
+        igraph_cattribute_EAS_set( g_out, GE_PSRC_NAME, eid,
+                igraph_cattribute_EAS( g, GE_PSRC_NAME, eid ) );
+        igraph_cattribute_EAS_set( g_out, GE_PDST_NAME, eid,
+                igraph_cattribute_EAS( g, GE_PDST_NAME, eid ) );
+    }
+
+    // the vertices of a template are appended, nested instances are expanded
+    // once the loop reaches them
+    igraph_vector_init( &eids, 0 );
+    igraph_vector_init( &nets, 0 );
+    for( vid = 0; vid < igraph_vcount( g_out ); vid++ ) {
+        name = igraph_cattribute_VAS( g_out, GV_TEMPLATE, vid );
+        if( strlen( name ) == 0 ) continue;
+        for( tpl = hier->tpls; tpl != NULL; tpl = tpl->hh.next )
+            if( strcmp( tpl->name, name ) == 0 ) break;
+        if( tpl == NULL ) continue;
+        g_tpl = &tpl->g;
+        has_tpl = igraph_cattribute_has_attr( g_tpl, IGRAPH_ATTRIBUTE_VERTEX,
+                GV_TEMPLATE );
+        igraph_vector_push_back( &nets, vid );
+
+        base = igraph_vcount( g_out );
+        v_cnt = igraph_vcount( g_tpl );
+        igraph_add_vertices( g_out, v_cnt, NULL );
+        for( tid = 0; tid < v_cnt; tid++ ) {
+            label = igraph_cattribute_VAS( g_tpl, GV_LABEL, tid );
+            path = malloc( strlen( igraph_cattribute_VAS( g_out, GV_PATH,
+                            vid ) ) + strlen( label ) + CONST_ID_LEN + 3 );
+            sprintf( path, "%s/%s_%d", igraph_cattribute_VAS( g_out, GV_PATH,
+                        vid ), label, tid );
+            igraph_cattribute_VAS_set( g_out, GV_LABEL, base + tid, label );
+            igraph_cattribute_VAS_set( g_out, GV_PATH, base + tid, path );
+            igraph_cattribute_VAS_set( g_out, GV_TEMPLATE, base + tid, has_tpl
+                    ? igraph_cattribute_VAS( g_tpl, GV_TEMPLATE, tid ) : "" );
+            free( path );
+        }
+        for( i = 0; i < igraph_ecount( g_tpl ); i++ ) {
+            igraph_edge( g_tpl, i, &from, &to );
+            eid = igraph_ecount( g_out );
+            igraph_add_edge( g_out, base + from, base + to );
+            igraph_cattribute_EAS_set( g_out, GE_LABEL, eid,
+                    igraph_cattribute_EAS( g_tpl, GE_LABEL, i ) );
+            igraph_cattribute_EAS_set( g_out, GE_PSRC_NAME, eid,
+                    igraph_cattribute_EAS( g_tpl, GE_PSRC_NAME, i ) );
+            igraph_cattribute_EAS_set( g_out, GE_PDST_NAME, eid,
+                    igraph_cattribute_EAS( g_tpl, GE_PDST_NAME, i ) );
+        }
+
+        // connect the channels of the instance to the interface of the
+        // template, the channels of the instance are removed
+        igraph_incident( g_out, &eids, vid, IGRAPH_ALL );
+        ports = strdup( igraph_cattribute_GAS( g_tpl, GG_PORTS ) );
+        port_name = malloc( strlen( ports ) + 1 );
+        for( port = strtok_r( ports, ";", &save ); port != NULL;
+                port = strtok_r( NULL, ";", &save ) ) {
+            // each port is given as 'mode name vertex_id'
+            if( sscanf( port, "%3s %s %d", mode, port_name, &tid ) != 3 )
+                continue;
+            for( i = 0; i < igraph_vector_size( &eids ); i++ ) {
+                eid = VECTOR( eids )[i];
+                igraph_edge( g_out, eid, &from, &to );
+                src = from;
+                dst = to;
+                if( ( to == vid ) && ( strcmp( mode, "out" ) != 0 )
+                        && ( strcmp( igraph_cattribute_EAS( g_out,
+                                    GE_PDST_NAME, eid ), port_name ) == 0 ) )
+                    dst = base + tid;
+                if( ( from == vid ) && ( strcmp( mode, "in" ) != 0 )
+                        && ( strcmp( igraph_cattribute_EAS( g_out,
+                                    GE_PSRC_NAME, eid ), port_name ) == 0 ) )
+                    src = base + tid;
+                if( ( src == from ) && ( dst == to ) ) continue;
+                igraph_add_edge( g_out, src, dst );
+                igraph_cattribute_EAS_set( g_out, GE_LABEL,
+                        igraph_ecount( g_out ) - 1,
+                        igraph_cattribute_EAS( g_out, GE_LABEL, eid ) );
+                igraph_cattribute_EAS_set( g_out, GE_PSRC_NAME,
+                        igraph_ecount( g_out ) - 1,
+                        igraph_cattribute_EAS( g_out, GE_PSRC_NAME, eid ) );
+                igraph_cattribute_EAS_set( g_out, GE_PDST_NAME,
+                        igraph_ecount( g_out ) - 1,
+                        igraph_cattribute_EAS( g_out, GE_PDST_NAME, eid ) );
+            }
+        }
+        free( port_name );
+        free( ports );
+        igraph_es_vector( &es, &eids );
+        igraph_delete_edges( g_out, es );
+        igraph_es_destroy( &es );
+    }
+
+    igraph_vs_vector( &vs, &nets );
+    igraph_delete_vertices( g_out, vs );
+    igraph_vs_destroy( &vs );
+    igraph_vector_destroy( &nets );
+    igraph_vector_destroy( &eids );
+    dgraph_destroy_attr_v( g_out, GV_TEMPLATE );
+    dgraph_destroy_attr_e( g_out, GE_PSRC_NAME );
+    dgraph_destroy_attr_e( g_out, GE_PDST_NAME );
+}
+
+/******************************************************************************/
+int smxhier_dot_group( igraph_t* g, int depth, igraph_vector_t* mapping,
+        hier_group_t** groups )
+{
+    int vid;
+    int len;
+    int level;
+    int cnt = 0;
+    const char* path;
+    hier_group_t* group;
+
+    for( vid = 0; vid < igraph_vcount( g ); vid++ ) {
+        path = igraph_cattribute_VAS( g, GV_PATH, vid );
+        // find the end of the instance path of the containing net
+        level = 0;
+        for( len = 0; path[len] != '\0'; len++ )
+            if( ( path[len] == '/' ) && ( ++level == depth ) ) break;
+        if( path[len] == '\0' ) {
+            VECTOR( *mapping )[vid] = cnt++;
+            continue;
+        }
+        HASH_FIND( hh, *groups, path, len, group );
+        if( group == NULL ) {
+            group = malloc( sizeof( hier_group_t ) );
+            group->name = malloc( len + 1 );
+            memcpy( group->name, path, len );
+            group->name[len] = '\0';
+            group->id = cnt++;
+            HASH_ADD_KEYPTR( hh, *groups, group->name, len, group );
+        }
+        VECTOR( *mapping )[vid] = group->id;
+    }
+    return cnt;
+}
+
+/******************************************************************************/
+void smxhier_dot_group_destroy( hier_group_t** groups )
+{
+    hier_group_t* group;
+    hier_group_t* tmp;
+
+    HASH_ITER( hh, *groups, group, tmp ) {
+        HASH_DEL( *groups, group );
+        free( group->name );
+        free( group );
+    }
+}
+
+/******************************************************************************/
+void smxhier_dot_reduce( igraph_t* g, igraph_t* g_out, int max_vertices )
+{
+    igraph_t g_net;
+    igraph_vector_t mapping;
+    igraph_attribute_combination_t comb;
+    hier_group_t* groups = NULL;
+    hier_group_t* group;
+    const char* path;
+    int vid;
+    int level;
+    int depth = 1;
+    int cnt;
+
+    // the deepest nesting of the graph
+    for( vid = 0; vid < igraph_vcount( g ); vid++ ) {
+        level = 1;
+        for( path = igraph_cattribute_VAS( g, GV_PATH, vid ); *path != '\0';
+                path++ )
+            if( *path == '/' ) level++;
+        if( level > depth ) depth = level;
+    }
+
+    igraph_vector_init( &mapping, igraph_vcount( g ) );
+    cnt = smxhier_dot_group( g, depth, &mapping, &groups );
+    while( ( cnt > max_vertices ) && ( depth > 1 ) ) {
+        depth--;
+        smxhier_dot_group_destroy( &groups );
+        cnt = smxhier_dot_group( g, depth, &mapping, &groups );
+    }
+
+    igraph_copy( &g_net, g );
+    igraph_attribute_combination( &comb,
+            GV_LABEL, IGRAPH_ATTRIBUTE_COMBINE_FIRST,
+            "", IGRAPH_ATTRIBUTE_COMBINE_IGNORE,
+            IGRAPH_NO_MORE_ATTRIBUTES );
+    igraph_contract_vertices( &g_net, &mapping, &comb );
+    igraph_attribute_combination_destroy( &comb );
+    for( group = groups; group != NULL; group = group->hh.next )
+        igraph_cattribute_VAS_set( &g_net, GV_LABEL, group->id, group->name );
+    smxhier_dot_collapse( &g_net, g_out );
+
+    igraph_destroy( &g_net );
+    igraph_vector_destroy( &mapping );
+    smxhier_dot_group_destroy( &groups );
+}
+
+/******************************************************************************/
+int smxhier_dot_write( igraph_t* g, const char* path, int max_vertices )
+{
+    FILE* out_file;
+    igraph_t g_dot;
+    int v_cnt = igraph_vcount( g );
+    int v_cnt_dot = v_cnt;
+    bool has_path = igraph_cattribute_has_attr( g, IGRAPH_ATTRIBUTE_VERTEX,
+            GV_PATH );
+
+    out_file = fopen( path, "w" );
+    if( out_file == NULL ) {
+        printf( "Cannot open file '%s'!\n", path );
+        return -1;
+    }
+    if( ( max_vertices > 0 ) && ( v_cnt > max_vertices ) && has_path ) {
+        smxhier_dot_reduce( g, &g_dot, max_vertices );
+        v_cnt_dot = igraph_vcount( &g_dot );
+        igraph_write_graph_dot( &g_dot, out_file );
+        igraph_destroy( &g_dot );
+        printf( " DOT view '%s' reduced from %d to %d vertices by collapsing"
+                " nets\n", path, v_cnt, v_cnt_dot );
+    }
+    else if( has_path ) {
+        igraph_copy( &g_dot, g );
+        dgraph_destroy_attr_v( &g_dot, GV_PATH );
+        igraph_write_graph_dot( &g_dot, out_file );
+        igraph_destroy( &g_dot );
+    }
+    else igraph_write_graph_dot( g, out_file );
+    if( ( max_vertices > 0 ) && ( v_cnt_dot > max_vertices ) )
+        printf( " DOT view '%s' exceeds the vertex budget of %d\n", path,
+                max_vertices );
+    fclose( out_file );
+    return 0;
+}
+
+/******************************************************************************/
+int smxhier_dot_write_insts( hier_t* hier, const char* path,
+        int max_vertices )
+{
+    int vid;
+    int file_cnt = 0;
+    const char* name;
+    const char* label;
+    char* dot_path;
+    tpl_t* tpl;
+
+    if( !igraph_cattribute_has_attr( &hier->g, IGRAPH_ATTRIBUTE_VERTEX,
+                GV_TEMPLATE ) )
+        return 0;
+
+    for( vid = 0; vid < igraph_vcount( &hier->g ); vid++ ) {
+        name = igraph_cattribute_VAS( &hier->g, GV_TEMPLATE, vid );
+        if( strlen( name ) == 0 ) continue;
+        for( tpl = hier->tpls; tpl != NULL; tpl = tpl->hh.next )
+            if( strcmp( tpl->name, name ) == 0 ) break;
+        if( tpl == NULL ) continue;
+        label = igraph_cattribute_VAS( &hier->g, GV_LABEL, vid );
+        dot_path = malloc( strlen( path ) + strlen( label ) + CONST_ID_LEN
+                + 7 );
+        sprintf( dot_path, "%s/%s_%d.dot", path, label, vid );
+        if( smxhier_dot_write_view( hier, &tpl->g, dot_path,
+                    max_vertices ) == 0 )
+            file_cnt++;
+        free( dot_path );
+    }
+    return file_cnt;
+}
+
+/******************************************************************************/
+int smxhier_dot_write_view( hier_t* hier, igraph_t* g, const char* path,
+        int max_vertices )
+{
+    int res;
+    igraph_t g_expanded;
+    igraph_t g_collapsed;
+
+    smxhier_dot_expand( hier, g, &g_expanded );
+    smxhier_dot_collapse( &g_expanded, &g_collapsed );
+    res = smxhier_dot_write( &g_collapsed, path, max_vertices );
+    igraph_destroy( &g_collapsed );
+    igraph_destroy( &g_expanded );
+    return res;
+}
+
+/******************************************************************************/
+void smxhier_export( igraph_t* g, igraph_t* g_out, tpl_t** tpls )
+{
+    int id;
+    virt_net_t* v_net;
+    virt_port_t* port;
+    symrec_t* symb;
+    igraph_t* g_tpl;
+    tpl_t* tpl;
+
+    igraph_copy( g_out, g );
+    // the attribute passes of the flattened graph, the structure of the
+    // template is kept and conflicts are reported on the flattened graph
+    post_process_decoupling( g_out );
+    post_process_farm( g_out );
+    post_process_msg_size( g_out );
+
+    for( id = 0; id < igraph_vcount( g ); id++ ) {
+        v_net = ( virt_net_t* )( uintptr_t )igraph_cattribute_VAN( g, GV_VNET,
+                id );
+        if( v_net->type != VNET_NET && v_net->type != VNET_WRAP ) continue;
+        symb = ( symrec_t* )( uintptr_t )igraph_cattribute_VAN( g, GV_SYMB,
+                id );
+        g_tpl = ( igraph_t* )( uintptr_t )igraph_cattribute_VAN( g, GV_GRAPH,
+                id );
+        tpl = smxhier_tpl_get( tpls, symb, g_tpl );
+        igraph_cattribute_VAS_set( g_out, GV_TEMPLATE, id, tpl->name );
+    }
+
+    for( id = 0; id < igraph_ecount( g ); id++ ) {
+        port = ( virt_port_t* )( uintptr_t )igraph_cattribute_EAN( g, GE_PSRC,
+                id );
+        igraph_cattribute_EAS_set( g_out, GE_PSRC_NAME, id, port->name );
+        port = ( virt_port_t* )( uintptr_t )igraph_cattribute_EAN( g, GE_PDST,
+                id );
+        igraph_cattribute_EAS_set( g_out, GE_PDST_NAME, id, port->name );
+    }
+
+    dgraph_destroy_attr_v( g_out, GV_SYMB );
+    dgraph_destroy_attr_v( g_out, GV_GRAPH );
+    dgraph_destroy_attr_v( g_out, GV_VNET );
+    // instance paths are only meaningful in the flattened graph
+    dgraph_destroy_attr_v( g_out, GV_PATH );
+    dgraph_destroy_attr_e( g_out, GE_PDST );
+    dgraph_destroy_attr_e( g_out, GE_PSRC );
+}
+
+/******************************************************************************/
+void smxhier_init( igraph_t* g, hier_t* hier )
+{
+    hier->tpls = NULL;
+    smxhier_export( g, &hier->g, &hier->tpls );
+}
+
+/******************************************************************************/
+tpl_t* smxhier_tpl_get( tpl_t** tpls, symrec_t* symb, igraph_t* g )
+{
+    tpl_t* tpl;
+    tpl_t* tmp;
+    int suffix = 1;
+    bool is_taken = true;
+
+    HASH_FIND_PTR( *tpls, &symb, tpl );
+    if( tpl != NULL ) return tpl;
+
+    // nets of different scopes may share the same name
+    tpl = malloc( sizeof( tpl_t ) );
+    tpl->symb = symb;
+    tpl->name = malloc( strlen( symb->name ) + CONST_ID_LEN + 2 );
+    strcpy( tpl->name, symb->name );
+    while( is_taken ) {
+        is_taken = false;
+        for( tmp = *tpls; tmp != NULL; tmp = tmp->hh.next ) {
+            if( strcmp( tmp->name, tpl->name ) == 0 ) {
+                sprintf( tpl->name, "%s_%d", symb->name, suffix++ );
+                is_taken = true;
+                break;
+            }
+        }
+    }
+    HASH_ADD_PTR( *tpls, symb, tpl );
+
+    smxhier_export( g, &tpl->g, tpls );
+    if( symb->type == SYMREC_WRAP )
+        smxhier_tpl_ports( &tpl->g, symb->attr_wrap->v_net );
+    else
+        smxhier_tpl_ports( &tpl->g, symb->attr_net->v_net );
+
+    return tpl;
+}
+
+/******************************************************************************/
+void smxhier_tpl_ports( igraph_t* g, virt_net_t* v_net )
+{
+    virt_port_list_t* ports;
+    const char* mode;
+    char* str;
+    int len = 1;
+
+    for( ports = v_net->ports; ports != NULL; ports = ports->next )
+        len += strlen( ports->port->name ) + CONST_ID_LEN + 6;
+
+    str = malloc( len );
+    str[0] = '\0';
+    len = 0;
+    for( ports = v_net->ports; ports != NULL; ports = ports->next ) {
+        if( ports->port->state == VPORT_STATE_CONNECTED ) continue;
+        if( ports->port->attr_mode == PORT_MODE_IN ) mode = "in";
+        else if( ports->port->attr_mode == PORT_MODE_OUT ) mode = "out";
+        else mode = "bi";
+        len += sprintf( &str[len], "%s%s %s %d", ( len > 0 ) ? ";" : "", mode,
+                ports->port->name, ports->port->v_net->inst->id );
+    }
+    igraph_cattribute_GAS_set( g, GG_PORTS, str );
+    free( str );
+}
+
+/******************************************************************************/
+int smxhier_write_tpls( hier_t* hier, const char* path, const char* format,
+        bool compress )
+{
+    tpl_t* tpl;
+    FILE* out_file;
+    char* tpl_path;
+    int tpl_cnt = 0;
+
+    for( tpl = hier->tpls; tpl != NULL; tpl = tpl->hh.next ) {
+        tpl_path = malloc( strlen( path ) + strlen( tpl->name )
+                + strlen( format ) + strlen( SMXZ_SUFFIX ) + 3 );
+        sprintf( tpl_path, "%s/%s.%s%s", path, tpl->name, format,
+                compress ? SMXZ_SUFFIX : "" );
+        out_file = compress ? smxz_fopen( tpl_path, "w" )
+            : fopen( tpl_path, "w" );
+        if( out_file == NULL ) {
+            printf( "Cannot open file '%s'!\n", tpl_path );
+            free( tpl_path );
+            continue;
+        }
+        if( strcmp( format, G_FMT_GML ) == 0 )
+            igraph_write_graph_gml( &tpl->g, out_file, NULL, G_GML_HEAD );
+        else
+            igraph_write_graph_graphml( &tpl->g, out_file, 0 );
+        fclose( out_file );
+        free( tpl_path );
+        tpl_cnt++;
+    }
+    return tpl_cnt;
+}
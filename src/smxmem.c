@@ -0,0 +1,196 @@
+/**
+ * Precomputed memory layout of all channel buffers
+ *
+ * @file    smxmem.c
+ * @author  Simon Maurer
+ *
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "smxmem.h"
+#include "defines.h"
+
+/******************************************************************************/
+uint64_t smxmem_align( uint64_t size, uint64_t align )
+{
+    return ( size + align - 1 ) & ~( align - 1 );
+}
+
+/******************************************************************************/
+int smxmem_footprint( igraph_t* g, uint64_t* bytes )
+{
+    int eid;
+    int len;
+    int size;
+    int ch_cnt = 0;
+
+    *bytes = 0;
+    if( !igraph_cattribute_has_attr( g, IGRAPH_ATTRIBUTE_EDGE, GE_MSG_SIZE ) )
+        return 0;
+    for( eid = 0; eid < igraph_ecount( g ); eid++ ) {
+        size = igraph_cattribute_EAN( g, GE_MSG_SIZE, eid );
+        if( size <= 0 ) continue;
+        len = igraph_cattribute_EAN( g, GE_LEN, eid );
+        if( len < 1 ) len = 1;
+        *bytes += ( uint64_t )len * size;
+        ch_cnt++;
+    }
+    return ch_cnt;
+}
+
+/******************************************************************************/
+void smxmem_footprint_print( int ch_cnt, uint64_t bytes )
+{
+    printf( " Memory footprint: %d channel(s) with declared message size in %"
+            PRIu64 " bytes\n", ch_cnt, bytes );
+}
+
+/******************************************************************************/
+void smxmem_layout( igraph_t* g, msg_size_t* sizes, mem_layout_t* layout )
+{
+    int eid;
+    int len;
+    uint64_t msg_size;
+    uint64_t offset = 0;
+
+    layout->ch_cnt = igraph_ecount( g );
+    layout->missing_cnt = 0;
+    for( eid = 0; eid < layout->ch_cnt; eid++ ) {
+        if( !smxmem_msg_size_get( g, sizes, eid, &msg_size ) )
+            layout->missing_cnt++;
+        len = igraph_cattribute_EAN( g, GE_LEN, eid );
+        if( len < 1 ) len = 1;
+        igraph_cattribute_EAN_set( g, GE_MSG_SIZE, eid, msg_size );
+        // producer and consumer indices on separate cache lines
+        igraph_cattribute_EAN_set( g, GE_MEM_WR, eid, offset );
+        offset += SMXMEM_CACHE_LINE;
+        igraph_cattribute_EAN_set( g, GE_MEM_RD, eid, offset );
+        offset += SMXMEM_CACHE_LINE;
+        igraph_cattribute_EAN_set( g, GE_MEM_BUF, eid, offset );
+        offset += smxmem_align( len * smxmem_align( msg_size, SMXMEM_ALIGN ),
+                SMXMEM_CACHE_LINE );
+    }
+    layout->size = offset;
+    layout->arena = smxmem_align( offset, SMXMEM_HUGE_PAGE );
+    igraph_cattribute_GAN_set( g, GG_MEM_ARENA, layout->arena );
+}
+
+/******************************************************************************/
+void smxmem_layout_print( mem_layout_t* layout )
+{
+    printf( " Memory layout: %d channel(s) in %" PRIu64 " bytes, arena of %"
+            PRIu64 " bytes\n", layout->ch_cnt, layout->size, layout->arena );
+    if( layout->missing_cnt > 0 )
+        printf( "  %d channel(s) without message size, assumed %d bytes\n",
+                layout->missing_cnt, ( int )SMXMEM_MSG_SIZE );
+}
+
+/******************************************************************************/
+void smxmem_msg_size_destroy( msg_size_t** sizes )
+{
+    msg_size_t* size;
+    msg_size_t* tmp;
+    HASH_ITER( hh, *sizes, size, tmp ) {
+        HASH_DEL( *sizes, size );
+        free( size->name );
+        free( size );
+    }
+}
+
+/******************************************************************************/
+bool smxmem_msg_size_get( igraph_t* g, msg_size_t* sizes, int eid,
+        uint64_t* size )
+{
+    int id_src, id_dst;
+    int declared = 0;
+    const char* label;
+    const char* box;
+    char* name;
+    msg_size_t* entry = NULL;
+
+    *size = SMXMEM_MSG_SIZE;
+    if( igraph_cattribute_has_attr( g, IGRAPH_ATTRIBUTE_EDGE, GE_MSG_SIZE ) )
+        declared = igraph_cattribute_EAN( g, GE_MSG_SIZE, eid );
+    if( sizes != NULL ) {
+        igraph_edge( g, eid, &id_src, &id_dst );
+        label = igraph_cattribute_EAS( g, GE_LABEL, eid );
+        box = igraph_cattribute_VAS( g, GV_LABEL, id_src );
+        name = malloc( strlen( box ) + strlen( label ) + 2 );
+        sprintf( name, "%s.%s", box, label );
+        HASH_FIND_STR( sizes, name, entry );
+        free( name );
+        if( entry == NULL ) HASH_FIND_STR( sizes, label, entry );
+    }
+    // the size declared on the ports is preferred over the wildcard
+    if( entry == NULL && declared > 0 ) {
+        *size = declared;
+        return true;
+    }
+    if( entry == NULL && sizes != NULL ) HASH_FIND_STR( sizes, "*", entry );
+    if( entry == NULL ) return false;
+    *size = entry->size;
+    return true;
+}
+
+/******************************************************************************/
+int smxmem_msg_size_read( const char* path, msg_size_t** sizes )
+{
+    FILE* file;
+    char* line = NULL;
+    char* name;
+    char* value;
+    char* unit;
+    char* save;
+    size_t len = 0;
+    int line_nb = 0;
+    int res = 0;
+    uint64_t bytes;
+    msg_size_t* size;
+
+    file = fopen( path, "r" );
+    if( file == NULL ) {
+        fprintf( stderr, "Cannot open file '%s'!\n", path );
+        return -1;
+    }
+    while( getline( &line, &len, file ) != -1 ) {
+        line_nb++;
+        name = strtok_r( line, " \t\r\n", &save );
+        if( name == NULL || name[0] == '#' ) continue;
+        value = strtok_r( NULL, " \t\r\n", &save );
+        if( value == NULL ) {
+            fprintf( stderr, "%s:%d: missing message size of '%s'\n", path,
+                    line_nb, name );
+            res = -1;
+            continue;
+        }
+        bytes = strtoull( value, &unit, 10 );
+        if( unit == value || bytes == 0 ) {
+            fprintf( stderr, "%s:%d: bad message size '%s'\n", path, line_nb,
+                    value );
+            res = -1;
+            continue;
+        }
+        if( strcmp( unit, "M" ) == 0 ) bytes *= 1024 * 1024;
+        else if( strcmp( unit, "k" ) == 0 ) bytes *= 1024;
+        else if( *unit != '\0' ) {
+            fprintf( stderr, "%s:%d: bad size unit '%s'\n", path, line_nb,
+                    unit );
+            res = -1;
+            continue;
+        }
+        HASH_FIND_STR( *sizes, name, size );
+        if( size == NULL ) {
+            size = malloc( sizeof( msg_size_t ) );
+            size->name = strdup( name );
+            HASH_ADD_KEYPTR( hh, *sizes, size->name, strlen( size->name ),
+                    size );
+        }
+        size->size = bytes;
+    }
+    free( line );
+    fclose( file );
+    return res;
+}
@@ -0,0 +1,643 @@
+/**
+ * Optimisation passes on the flattened dependency graph
+ *
+ * @file    smxopt.c
+ * @author  Simon Maurer
+ *
+ */
+
+#include "smxopt.h"
+#include "defines.h"
+#include "smxana.h"
+#include "smxgraph.h"
+
+/******************************************************************************/
+void smxopt_contract( igraph_t* g, int* parent, int* root,
+        igraph_vector_t* dids, igraph_vector_t* v_new )
+{
+    int vid;
+    int id_new = 0;
+    int v_count = igraph_vcount( g );
+    igraph_attribute_combination_t comb;
+    igraph_es_t es;
+
+    igraph_vector_resize( v_new, v_count );
+    for( vid = 0; vid < v_count; vid++ ) {
+        if( parent[vid] >= 0 && root[vid] >= 0 ) continue;
+        VECTOR( *v_new )[vid] = id_new;
+        id_new++;
+    }
+    for( vid = 0; vid < v_count; vid++ ) {
+        if( parent[vid] >= 0 && root[vid] >= 0 )
+            VECTOR( *v_new )[vid] = VECTOR( *v_new )[ root[vid] ];
+    }
+
+    igraph_attribute_combination( &comb,
+            GV_LABEL, IGRAPH_ATTRIBUTE_COMBINE_FIRST,
+            GV_IMPL, IGRAPH_ATTRIBUTE_COMBINE_FIRST,
+            GV_SYMB, IGRAPH_ATTRIBUTE_COMBINE_FIRST,
+            GV_VNET, IGRAPH_ATTRIBUTE_COMBINE_FIRST,
+            GV_GRAPH, IGRAPH_ATTRIBUTE_COMBINE_FIRST,
+            GV_STATIC, IGRAPH_ATTRIBUTE_COMBINE_FIRST,
+            GV_PURE, IGRAPH_ATTRIBUTE_COMBINE_FIRST,
+            GV_LOCATION, IGRAPH_ATTRIBUTE_COMBINE_FIRST,
+            GV_TT, IGRAPH_ATTRIBUTE_COMBINE_FIRST,
+            GV_FARM, IGRAPH_ATTRIBUTE_COMBINE_FIRST,
+            GV_REPLICA, IGRAPH_ATTRIBUTE_COMBINE_FIRST,
+            GV_PATH, IGRAPH_ATTRIBUTE_COMBINE_FIRST,
+            IGRAPH_NO_MORE_ATTRIBUTES );
+    igraph_contract_vertices( g, v_new, &comb );
+    igraph_attribute_combination_destroy( &comb );
+
+    // the contraction preserves edge ids, remove the internal channels
+    es = igraph_ess_vector( dids );
+    igraph_delete_edges( g, es );
+    igraph_es_destroy( &es );
+    dgraph_edge_update_ids( g );
+}
+
+/******************************************************************************/
+int smxopt_fuse_pure( igraph_t* g )
+{
+    int vid, eid, id_src, id_dst, id_root, id;
+    int cnt = 0;
+    int v_count = igraph_vcount( g );
+    int* parent;
+    int* next;
+    int* root;
+    int* path;
+    char** impls;
+    char** labels;
+    const char* impl;
+    const char* label;
+    virt_net_t *v_net, *v_net_root;
+    virt_port_t *p_src, *p_dst;
+    igraph_vector_t eids, v_new, dids, deg_in, deg_out;
+    igraph_es_t es;
+    igraph_eit_t eit;
+
+    if( v_count == 0 ) return 0;
+
+    parent = malloc( sizeof( int ) * v_count );
+    next = malloc( sizeof( int ) * v_count );
+    root = malloc( sizeof( int ) * v_count );
+    path = malloc( sizeof( int ) * v_count );
+    impls = malloc( sizeof( char* ) * v_count );
+    labels = malloc( sizeof( char* ) * v_count );
+    igraph_vector_init( &eids, 0 );
+    igraph_vector_init( &dids, 0 );
+    igraph_vector_init( &v_new, 0 );
+    igraph_vector_init( &deg_in, 0 );
+    igraph_vector_init( &deg_out, 0 );
+    igraph_degree( g, &deg_in, igraph_vss_all(), IGRAPH_IN, true );
+    igraph_degree( g, &deg_out, igraph_vss_all(), IGRAPH_OUT, true );
+
+    for( vid = 0; vid < v_count; vid++ ) {
+        parent[vid] = -1;
+        next[vid] = -1;
+        root[vid] = -2;
+        impls[vid] = NULL;
+        labels[vid] = NULL;
+    }
+
+    // link two pure boxes if the channel between them is the only output of
+    // the source and the only input of the destination
+    es = igraph_ess_all( IGRAPH_EDGEORDER_ID );
+    igraph_eit_create( g, es, &eit );
+    while( !IGRAPH_EIT_END( eit ) ) {
+        eid = IGRAPH_EIT_GET( eit );
+        igraph_edge( g, eid, &id_src, &id_dst );
+        if( ( VECTOR( deg_out )[id_src] == 1 )
+                && ( VECTOR( deg_in )[id_dst] == 1 )
+                && smxopt_fuse_pure_is_link_ok( g, id_src, id_dst )
+                && smxopt_is_edge_fusable( g, eid ) ) {
+            parent[id_dst] = id_src;
+            next[id_src] = id_dst;
+        }
+        IGRAPH_EIT_NEXT( eit );
+    }
+    igraph_eit_destroy( &eit );
+    igraph_es_destroy( &es );
+
+    // collect the implementations and names of each chain in order
+    for( vid = 0; vid < v_count; vid++ ) {
+        if( smxopt_fuse_root( parent, root, path, vid ) != vid ) continue;
+        if( next[vid] < 0 ) continue;
+        impls[vid] = strdup( igraph_cattribute_VAS( g, GV_IMPL, vid ) );
+        labels[vid] = strdup( igraph_cattribute_VAS( g, GV_LABEL, vid ) );
+        for( id = next[vid]; id >= 0; id = next[id] ) {
+            impl = igraph_cattribute_VAS( g, GV_IMPL, id );
+            label = igraph_cattribute_VAS( g, GV_LABEL, id );
+            impls[vid] = realloc( impls[vid], strlen( impls[vid] )
+                    + strlen( TEXT_IMPL_SEP ) + strlen( impl ) + 1 );
+            strcat( impls[vid], TEXT_IMPL_SEP );
+            strcat( impls[vid], impl );
+            labels[vid] = realloc( labels[vid], strlen( labels[vid] )
+                    + strlen( TEXT_IMPL_SEP ) + strlen( label ) + 1 );
+            strcat( labels[vid], TEXT_IMPL_SEP );
+            strcat( labels[vid], label );
+        }
+    }
+
+    // drop the ports of the internal channels
+    for( vid = 0; vid < v_count; vid++ ) {
+        if( parent[vid] < 0 || root[vid] < 0 ) continue;
+        igraph_incident( g, &eids, vid, IGRAPH_IN );
+        eid = VECTOR( eids )[0];
+        igraph_vector_push_back( &dids, eid );
+        p_src = ( virt_port_t* )( uintptr_t ) igraph_cattribute_EAN( g,
+                GE_PSRC, eid );
+        p_dst = ( virt_port_t* )( uintptr_t ) igraph_cattribute_EAN( g,
+                GE_PDST, eid );
+        v_net = ( virt_net_t* )( uintptr_t )igraph_cattribute_VAN( g,
+                GV_VNET, parent[vid] );
+        virt_port_remove( v_net, p_src );
+        v_net = ( virt_net_t* )( uintptr_t )igraph_cattribute_VAN( g,
+                GV_VNET, vid );
+        virt_port_remove( v_net, p_dst );
+    }
+
+    // move the remaining ports of all stages to the head of the chain
+    for( vid = 0; vid < v_count; vid++ ) {
+        id_root = root[vid];
+        if( parent[vid] < 0 || id_root < 0 ) continue;
+        v_net_root = ( virt_net_t* )( uintptr_t )igraph_cattribute_VAN( g,
+                GV_VNET, id_root );
+        v_net = ( virt_net_t* )( uintptr_t )igraph_cattribute_VAN( g,
+                GV_VNET, vid );
+#if defined(DEBUG) || defined(DEBUG_FUSE_PURE)
+        printf( "smxopt_fuse_pure: fuse %s(%d) into %s(%d)\n",
+                v_net->inst->name, vid, v_net_root->inst->name, id_root );
+#endif // DEBUG_FUSE_PURE
+        virt_port_append_all( v_net_root, v_net, true );
+        virt_net_destroy_shallow( v_net );
+        igraph_cattribute_VAN_set( g, GV_VNET, vid, ( uintptr_t )v_net_root );
+        igraph_cattribute_VAN_set( g, GV_SYMB, vid,
+                igraph_cattribute_VAN( g, GV_SYMB, id_root ) );
+        cnt++;
+    }
+
+    if( cnt > 0 ) {
+        smxopt_contract( g, parent, root, &dids, &v_new );
+        for( vid = 0; vid < v_count; vid++ ) {
+            if( impls[vid] == NULL ) continue;
+            igraph_cattribute_VAS_set( g, GV_IMPL, VECTOR( v_new )[vid],
+                    impls[vid] );
+            igraph_cattribute_VAS_set( g, GV_LABEL, VECTOR( v_new )[vid],
+                    labels[vid] );
+        }
+    }
+
+    for( vid = 0; vid < v_count; vid++ ) {
+        free( impls[vid] );
+        free( labels[vid] );
+    }
+    igraph_vector_destroy( &eids );
+    igraph_vector_destroy( &dids );
+    igraph_vector_destroy( &v_new );
+    igraph_vector_destroy( &deg_in );
+    igraph_vector_destroy( &deg_out );
+    free( parent );
+    free( next );
+    free( root );
+    free( path );
+    free( impls );
+    free( labels );
+    return cnt;
+}
+
+/******************************************************************************/
+bool smxopt_fuse_pure_is_link_ok( igraph_t* g, int id_src, int id_dst )
+{
+    virt_net_t* v_net_src;
+    virt_net_t* v_net_dst;
+
+    if( id_src == id_dst )
+        return false;
+    v_net_src = ( virt_net_t* )( uintptr_t )igraph_cattribute_VAN( g,
+            GV_VNET, id_src );
+    v_net_dst = ( virt_net_t* )( uintptr_t )igraph_cattribute_VAN( g,
+            GV_VNET, id_dst );
+    if( v_net_src->type != VNET_BOX || v_net_dst->type != VNET_BOX )
+        return false;
+    if( !igraph_cattribute_VAN( g, GV_PURE, id_src )
+            || !igraph_cattribute_VAN( g, GV_PURE, id_dst ) )
+        return false;
+    // only local boxes can be merged into one implementation
+    if( igraph_cattribute_VAN( g, GV_LOCATION, id_src ) != LOCATION_LOCAL
+            || igraph_cattribute_VAN( g, GV_LOCATION, id_dst )
+                != LOCATION_LOCAL )
+        return false;
+    if( igraph_cattribute_VAN( g, GV_TT, id_src )
+            != igraph_cattribute_VAN( g, GV_TT, id_dst ) )
+        return false;
+    if( igraph_cattribute_VAN( g, GV_STATIC, id_src )
+            != igraph_cattribute_VAN( g, GV_STATIC, id_dst ) )
+        return false;
+    return true;
+}
+
+/******************************************************************************/
+int smxopt_fuse_rn( igraph_t* g )
+{
+    int vid, eid, id_src, id_dst, id_a, id_b, id_root;
+    int cnt = 0;
+    int q_head = 0;
+    int q_tail = 0;
+    int v_count = igraph_vcount( g );
+    int e_count = igraph_ecount( g );
+    int* group;
+    int* parent;
+    int* root;
+    int* deg_int;
+    int* ext_cnt;
+    int* entry;
+    int* queue;
+    int* tt;
+    bool* is_rn;
+    bool* is_internal;
+    virt_net_t *v_net, *v_net_root;
+    virt_port_t *p_src, *p_dst;
+    igraph_vector_t eids, v_new, dids;
+
+    if( v_count == 0 ) return 0;
+
+    group = malloc( sizeof( int ) * v_count );
+    parent = malloc( sizeof( int ) * v_count );
+    root = malloc( sizeof( int ) * v_count );
+    deg_int = calloc( v_count, sizeof( int ) );
+    ext_cnt = calloc( v_count, sizeof( int ) );
+    entry = malloc( sizeof( int ) * v_count );
+    queue = malloc( sizeof( int ) * v_count );
+    tt = malloc( sizeof( int ) * v_count );
+    is_rn = calloc( v_count, sizeof( bool ) );
+    is_internal = calloc( e_count + 1, sizeof( bool ) );
+    igraph_vector_init( &eids, 0 );
+    igraph_vector_init( &dids, 0 );
+    igraph_vector_init( &v_new, 0 );
+
+    // the routing nodes of farms do not copy messages
+    for( vid = 0; vid < v_count; vid++ ) {
+        group[vid] = vid;
+        parent[vid] = -1;
+        root[vid] = -1;
+        entry[vid] = -1;
+        tt[vid] = igraph_cattribute_VAN( g, GV_TT, vid );
+        v_net = ( virt_net_t* )( uintptr_t )igraph_cattribute_VAN( g,
+                GV_VNET, vid );
+        is_rn[vid] = ( v_net->type == VNET_SYNC )
+            && !dgraph_vertex_is_farm_rn( g, vid );
+    }
+
+    // routing nodes connected by fusable channels form a group
+    for( eid = 0; eid < e_count; eid++ ) {
+        igraph_edge( g, eid, &id_src, &id_dst );
+        if( !is_rn[id_src] || !is_rn[id_dst] ) continue;
+        if( !smxopt_is_edge_fusable( g, eid ) ) continue;
+        is_internal[eid] = true;
+        deg_int[id_dst]++;
+        id_a = smxana_group_find( group, id_src );
+        id_b = smxana_group_find( group, id_dst );
+        if( id_a < id_b ) group[id_b] = id_a;
+        else group[id_a] = id_b;
+    }
+
+    // count the channels entering each group from outside and remember the
+    // routing node they enter
+    for( eid = 0; eid < e_count; eid++ ) {
+        igraph_edge( g, eid, &id_src, &id_dst );
+        if( !is_rn[id_dst] || is_internal[eid] ) continue;
+        id_a = smxana_group_find( group, id_dst );
+        ext_cnt[id_a]++;
+        entry[id_a] = id_dst;
+    }
+
+    // sort the groups topologically (Kahn), the routing nodes left with
+    // internal input channels are part of a cycle. A routing node without
+    // internal input channels must be fed by the producer of the group.
+    for( vid = 0; vid < v_count; vid++ ) {
+        if( !is_rn[vid] || deg_int[vid] > 0 ) continue;
+        id_a = smxana_group_find( group, vid );
+        if( entry[id_a] != vid ) ext_cnt[id_a] = -1;
+        queue[q_tail++] = vid;
+    }
+    while( q_head < q_tail ) {
+        igraph_incident( g, &eids, queue[q_head++], IGRAPH_OUT );
+        for( id_a = 0; id_a < igraph_vector_size( &eids ); id_a++ ) {
+            eid = VECTOR( eids )[id_a];
+            if( !is_internal[eid] ) continue;
+            igraph_edge( g, eid, &id_src, &id_dst );
+            if( --deg_int[id_dst] == 0 ) queue[q_tail++] = id_dst;
+        }
+    }
+    for( vid = 0; vid < v_count; vid++ ) {
+        if( is_rn[vid] && deg_int[vid] > 0 )
+            ext_cnt[ smxana_group_find( group, vid ) ] = -1;
+    }
+
+    // only fuse acyclic groups with a single producer, the routing node fed
+    // by this producer becomes the root of the group
+    for( vid = 0; vid < v_count; vid++ ) {
+        if( !is_rn[vid] ) continue;
+        id_a = smxana_group_find( group, vid );
+        if( ext_cnt[id_a] != 1 ) continue;
+        id_root = entry[id_a];
+        root[vid] = id_root;
+        if( id_root == vid ) continue;
+        parent[vid] = id_root;
+        if( tt[vid] > tt[id_root] ) tt[id_root] = tt[vid];
+    }
+
+    // remove the channels internal to the fused groups
+    for( eid = 0; eid < e_count; eid++ ) {
+        if( !is_internal[eid] ) continue;
+        igraph_edge( g, eid, &id_src, &id_dst );
+        if( parent[id_dst] < 0 ) continue;
+        igraph_vector_push_back( &dids, eid );
+        p_src = ( virt_port_t* )( uintptr_t ) igraph_cattribute_EAN( g,
+                GE_PSRC, eid );
+        p_dst = ( virt_port_t* )( uintptr_t ) igraph_cattribute_EAN( g,
+                GE_PDST, eid );
+        p_src->state = VPORT_STATE_DISABLED;
+        p_dst->state = VPORT_STATE_DISABLED;
+    }
+
+    // move the ports of the absorbed routing nodes to the root of the group
+    for( vid = 0; vid < v_count; vid++ ) {
+        id_root = parent[vid];
+        if( id_root < 0 ) continue;
+        v_net_root = ( virt_net_t* )( uintptr_t )igraph_cattribute_VAN( g,
+                GV_VNET, id_root );
+        v_net = ( virt_net_t* )( uintptr_t )igraph_cattribute_VAN( g,
+                GV_VNET, vid );
+#if defined(DEBUG) || defined(DEBUG_FUSE_RN)
+        printf( "smxopt_fuse_rn: fuse %s(%d) into %s(%d)\n",
+                v_net->inst->name, vid, v_net_root->inst->name, id_root );
+#endif // DEBUG_FUSE_RN
+        virt_port_append_all( v_net_root, v_net, true );
+        virt_net_destroy_shallow( v_net );
+        // make sure the root keeps its attributes when contracting
+        igraph_cattribute_VAN_set( g, GV_VNET, vid, ( uintptr_t )v_net_root );
+        igraph_cattribute_VAN_set( g, GV_SYMB, vid,
+                igraph_cattribute_VAN( g, GV_SYMB, id_root ) );
+        cnt++;
+    }
+
+    if( cnt > 0 ) {
+        smxopt_contract( g, parent, root, &dids, &v_new );
+        for( vid = 0; vid < v_count; vid++ ) {
+            if( root[vid] == vid && tt[vid] > 0 )
+                igraph_cattribute_VAN_set( g, GV_TT, VECTOR( v_new )[vid],
+                        tt[vid] );
+        }
+    }
+
+    igraph_vector_destroy( &eids );
+    igraph_vector_destroy( &dids );
+    igraph_vector_destroy( &v_new );
+    free( group );
+    free( parent );
+    free( root );
+    free( deg_int );
+    free( ext_cnt );
+    free( entry );
+    free( queue );
+    free( tt );
+    free( is_rn );
+    free( is_internal );
+    return cnt;
+}
+
+/******************************************************************************/
+int smxopt_fuse_root( int* parent, int* root, int* path, int vid )
+{
+    int id = vid;
+    int id_root = -1;
+    int len = 0;
+
+    // walk up the tree and mark the path as visited (-3)
+    while( root[id] == -2 ) {
+        root[id] = -3;
+        path[len++] = id;
+        if( parent[id] < 0 ) break;
+        id = parent[id];
+    }
+    if( root[id] == -3 && parent[id] < 0 ) id_root = id;
+    else if( root[id] >= 0 ) id_root = root[id];
+    // a visited vertex with a parent is part of a cycle (id_root stays -1)
+
+    while( len > 0 ) root[ path[--len] ] = id_root;
+    return id_root;
+}
+
+/******************************************************************************/
+bool smxopt_is_edge_fusable( igraph_t* g, int eid )
+{
+    if( igraph_cattribute_EAN( g, GE_DSRC, eid )
+            || igraph_cattribute_EAN( g, GE_DDST, eid ) )
+        return false;
+    if( igraph_cattribute_EAN( g, GE_TYPE, eid ) != TIME_NONE )
+        return false;
+    if( igraph_cattribute_EAN( g, GE_DYNSRC, eid )
+            || igraph_cattribute_EAN( g, GE_DYNDST, eid ) )
+        return false;
+    return true;
+}
+
+/******************************************************************************/
+int smxopt_renumber( igraph_t* g )
+{
+    int vid, eid, id_src, id_dst;
+    int cnt = 0;
+    int v_count = igraph_vcount( g );
+    int e_count = igraph_ecount( g );
+    int* order;
+    renum_edge_t* edges;
+    virt_net_t* v_net;
+    igraph_vector_t v_new;
+    igraph_attribute_combination_t comb;
+
+    if( v_count == 0 ) return 0;
+
+    order = malloc( sizeof( int ) * v_count );
+    smxopt_renumber_order( g, order );
+    igraph_vector_init( &v_new, v_count );
+    for( vid = 0; vid < v_count; vid++ ) {
+        igraph_cattribute_VAN_set( g, GV_ORIG_ID, vid, vid );
+        VECTOR( v_new )[ order[vid] ] = vid;
+        if( order[vid] != vid ) cnt++;
+    }
+    // a bijective contraction is a permutation, the edge ids are preserved
+    igraph_attribute_combination( &comb,
+            "", IGRAPH_ATTRIBUTE_COMBINE_FIRST,
+            IGRAPH_NO_MORE_ATTRIBUTES );
+    igraph_contract_vertices( g, &v_new, &comb );
+    igraph_attribute_combination_destroy( &comb );
+    igraph_vector_destroy( &v_new );
+    for( vid = 0; vid < v_count; vid++ ) {
+        v_net = ( virt_net_t* )( uintptr_t )igraph_cattribute_VAN( g, GV_VNET,
+                vid );
+        v_net->inst->id = vid;
+    }
+    free( order );
+
+    edges = malloc( sizeof( renum_edge_t ) * ( e_count + 1 ) );
+    for( eid = 0; eid < e_count; eid++ ) {
+        igraph_cattribute_EAN_set( g, GE_ORIG_ID, eid, eid );
+        igraph_edge( g, eid, &id_src, &id_dst );
+        edges[eid].id_src = id_src;
+        edges[eid].id_dst = id_dst;
+        edges[eid].eid = eid;
+    }
+    qsort( edges, e_count, sizeof( renum_edge_t ), smxopt_renumber_cmp );
+    order = malloc( sizeof( int ) * ( e_count + 1 ) );
+    for( eid = 0; eid < e_count; eid++ )
+        order[eid] = edges[eid].eid;
+    smxopt_renumber_edges( g, order );
+    free( order );
+    free( edges );
+
+    return cnt;
+}
+
+/******************************************************************************/
+int smxopt_renumber_cmp( const void* a, const void* b )
+{
+    const renum_edge_t* e_a = a;
+    const renum_edge_t* e_b = b;
+
+    if( e_a->id_src != e_b->id_src ) return e_a->id_src - e_b->id_src;
+    if( e_a->id_dst != e_b->id_dst ) return e_a->id_dst - e_b->id_dst;
+    return e_a->eid - e_b->eid;
+}
+
+/******************************************************************************/
+void smxopt_renumber_edges( igraph_t* g, int* order )
+{
+    int eid, id_src, id_dst, i;
+    int e_count = igraph_ecount( g );
+    const char* name;
+    igraph_vector_t edges;
+    igraph_strvector_t g_names, v_names, e_names;
+    igraph_vector_t g_types, v_types, e_types;
+    igraph_es_t es;
+
+    if( e_count == 0 ) return;
+
+    igraph_vector_init( &edges, 2 * e_count );
+    for( eid = 0; eid < e_count; eid++ ) {
+        igraph_edge( g, order[eid], &id_src, &id_dst );
+        VECTOR( edges )[2 * eid] = id_src;
+        VECTOR( edges )[2 * eid + 1] = id_dst;
+    }
+    igraph_add_edges( g, &edges, 0 );
+    igraph_vector_destroy( &edges );
+
+    igraph_strvector_init( &g_names, 0 );
+    igraph_strvector_init( &v_names, 0 );
+    igraph_strvector_init( &e_names, 0 );
+    igraph_vector_init( &g_types, 0 );
+    igraph_vector_init( &v_types, 0 );
+    igraph_vector_init( &e_types, 0 );
+    igraph_cattribute_list( g, &g_names, &g_types, &v_names, &v_types,
+            &e_names, &e_types );
+    for( i = 0; i < igraph_strvector_size( &e_names ); i++ ) {
+        name = STR( e_names, i );
+        for( eid = 0; eid < e_count; eid++ ) {
+            if( VECTOR( e_types )[i] == IGRAPH_ATTRIBUTE_STRING )
+                igraph_cattribute_EAS_set( g, name, e_count + eid,
+                        igraph_cattribute_EAS( g, name, order[eid] ) );
+            else if( VECTOR( e_types )[i] == IGRAPH_ATTRIBUTE_BOOLEAN )
+                igraph_cattribute_EAB_set( g, name, e_count + eid,
+                        igraph_cattribute_EAB( g, name, order[eid] ) );
+            else
+                igraph_cattribute_EAN_set( g, name, e_count + eid,
+                        igraph_cattribute_EAN( g, name, order[eid] ) );
+        }
+    }
+    igraph_strvector_destroy( &g_names );
+    igraph_strvector_destroy( &v_names );
+    igraph_strvector_destroy( &e_names );
+    igraph_vector_destroy( &g_types );
+    igraph_vector_destroy( &v_types );
+    igraph_vector_destroy( &e_types );
+
+    es = igraph_ess_seq( 0, e_count - 1 );
+    igraph_delete_edges( g, es );
+    igraph_es_destroy( &es );
+    dgraph_edge_update_ids( g );
+}
+
+/******************************************************************************/
+void smxopt_renumber_order( igraph_t* g, int* order )
+{
+    int vid, eid, id_src, id_dst, id, i, j, seed, pass, tmp;
+    int v_count = igraph_vcount( g );
+    int head = 0;
+    int tail = 0;
+    int start;
+    bool* is_visited;
+    igraph_vector_t deg, deg_in, eids;
+
+    is_visited = malloc( sizeof( bool ) * v_count );
+    for( vid = 0; vid < v_count; vid++ ) is_visited[vid] = false;
+    igraph_vector_init( &deg, 0 );
+    igraph_vector_init( &deg_in, 0 );
+    igraph_vector_init( &eids, 0 );
+    igraph_degree( g, &deg, igraph_vss_all(), IGRAPH_ALL, true );
+    igraph_degree( g, &deg_in, igraph_vss_all(), IGRAPH_IN, true );
+
+    // first start at sources, then at any vertex of the remaining components
+    for( pass = 0; pass < 2; pass++ ) {
+        for( seed = 0; seed < v_count; seed++ ) {
+            if( is_visited[seed] ) continue;
+            if( pass == 0 && VECTOR( deg_in )[seed] > 0 ) continue;
+            is_visited[seed] = true;
+            order[tail++] = seed;
+            while( head < tail ) {
+                vid = order[head++];
+                start = tail;
+                igraph_incident( g, &eids, vid, IGRAPH_ALL );
+                for( i = 0; i < igraph_vector_size( &eids ); i++ ) {
+                    eid = VECTOR( eids )[i];
+                    igraph_edge( g, eid, &id_src, &id_dst );
+                    id = ( id_src == vid ) ? id_dst : id_src;
+                    if( is_visited[id] ) continue;
+                    is_visited[id] = true;
+                    order[tail++] = id;
+                }
+                // enqueue the new neighbours by increasing degree
+                for( i = start + 1; i < tail; i++ ) {
+                    tmp = order[i];
+                    for( j = i; j > start; j-- ) {
+                        if( VECTOR( deg )[ order[j - 1] ] < VECTOR( deg )[tmp]
+                                || ( VECTOR( deg )[ order[j - 1] ]
+                                    == VECTOR( deg )[tmp]
+                                    && order[j - 1] < tmp ) )
+                            break;
+                        order[j] = order[j - 1];
+                    }
+                    order[j] = tmp;
+                }
+            }
+        }
+    }
+
+    igraph_vector_destroy( &deg );
+    igraph_vector_destroy( &deg_in );
+    igraph_vector_destroy( &eids );
+    free( is_visited );
+}
+
+/******************************************************************************/
+long smxopt_span( igraph_t* g )
+{
+    int eid, id_src, id_dst;
+    long span = 0;
+
+    for( eid = 0; eid < igraph_ecount( g ); eid++ ) {
+        igraph_edge( g, eid, &id_src, &id_dst );
+        span += ( id_src > id_dst ) ? id_src - id_dst : id_dst - id_src;
+    }
+    return span;
+}
@@ -0,0 +1,262 @@
+/**
+ * Streaming deflate compression of graph files
+ *
+ * @file    smxz.c
+ * @author  Simon Maurer
+ *
+ */
+
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+#include "smxz.h"
+#include "defines.h"
+
+/******************************************************************************/
+int smxz_close( void* cookie )
+{
+    return ( gzclose( ( gzFile )cookie ) == Z_OK ) ? 0 : EOF;
+}
+
+/******************************************************************************/
+long smxz_deflate( FILE* out, const char* buf, size_t len )
+{
+    z_stream strm;
+    unsigned char chunk[SMXZ_CHUNK];
+    size_t have;
+    long total = 0;
+    int res;
+
+    memset( &strm, 0, sizeof( z_stream ) );
+    // 15 window bits plus 16 to write a gzip header
+    if( deflateInit2( &strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8,
+                Z_DEFAULT_STRATEGY ) != Z_OK )
+        return -1;
+    strm.next_in = ( unsigned char* )buf;
+    strm.avail_in = len;
+    do {
+        strm.next_out = chunk;
+        strm.avail_out = SMXZ_CHUNK;
+        res = deflate( &strm, Z_FINISH );
+        have = SMXZ_CHUNK - strm.avail_out;
+        if( fwrite( chunk, 1, have, out ) != have ) {
+            deflateEnd( &strm );
+            return -1;
+        }
+        total += have;
+    } while( res == Z_OK );
+    deflateEnd( &strm );
+    return ( res == Z_STREAM_END ) ? total : -1;
+}
+
+/******************************************************************************/
+FILE* smxz_fopen( const char* path, const char* mode )
+{
+    gzFile gz;
+    FILE* stream;
+    cookie_io_functions_t io = { smxz_read, smxz_write, NULL, smxz_close };
+
+    gz = gzopen( path, ( mode[0] == 'w' ) ? "wb" : "rb" );
+    if( gz == NULL ) return NULL;
+    stream = fopencookie( gz, ( mode[0] == 'w' ) ? "w" : "r", io );
+    if( stream == NULL ) gzclose( gz );
+    return stream;
+}
+
+/******************************************************************************/
+const char* smxz_format( const char* path )
+{
+    const char* ext;
+    size_t len = strlen( path );
+    size_t len_suffix = strlen( SMXZ_SUFFIX );
+
+    if( len >= len_suffix
+            && strcmp( path + len - len_suffix, SMXZ_SUFFIX ) == 0 )
+        len -= len_suffix;
+    // find the extension in front of the compression suffix
+    ext = path + len;
+    while( ext > path && *( ext - 1 ) != '.' && *( ext - 1 ) != '/' ) ext--;
+    if( ext == path || *( ext - 1 ) != '.' ) return NULL;
+    len -= ext - path;
+    if( len == strlen( G_FMT_GML ) && strncmp( ext, G_FMT_GML, len ) == 0 )
+        return G_FMT_GML;
+    if( len == strlen( G_FMT_GRAPHML )
+            && strncmp( ext, G_FMT_GRAPHML, len ) == 0 )
+        return G_FMT_GRAPHML;
+    return NULL;
+}
+
+/******************************************************************************/
+char* smxz_inflate( const char* buf, size_t len, size_t* out_len )
+{
+    z_stream strm;
+    char* out;
+    size_t size = 4 * len + SMXZ_CHUNK;
+    int res;
+
+    memset( &strm, 0, sizeof( z_stream ) );
+    if( inflateInit2( &strm, 15 + 16 ) != Z_OK ) return NULL;
+    out = malloc( size );
+    strm.next_in = ( unsigned char* )buf;
+    strm.avail_in = len;
+    do {
+        if( strm.total_out == size ) {
+            size *= 2;
+            out = realloc( out, size );
+        }
+        strm.next_out = ( unsigned char* )&out[strm.total_out];
+        strm.avail_out = size - strm.total_out;
+        res = inflate( &strm, Z_NO_FLUSH );
+    } while( res == Z_OK );
+    *out_len = strm.total_out;
+    inflateEnd( &strm );
+    if( res != Z_STREAM_END ) {
+        free( out );
+        return NULL;
+    }
+    return out;
+}
+
+/******************************************************************************/
+ssize_t smxz_read( void* cookie, char* buf, size_t size )
+{
+    return gzread( ( gzFile )cookie, buf, size );
+}
+
+/******************************************************************************/
+int smxz_read_archive( igraph_t* g, const char* path, const char* name )
+{
+    FILE* in_file;
+    FILE* mem_file;
+    char head[128];
+    char format[16];
+    char mode[16];
+    char* entry;
+    char* entry_name;
+    char* buf;
+    char* data;
+    size_t data_len;
+    long toc, offset = -1, size = 0;
+    int version, count, entry_len, lo, hi, mid, cmp, res;
+
+    in_file = fopen( path, "r" );
+    if( in_file == NULL ) {
+        printf( "Cannot open file '%s'!\n", path );
+        return -1;
+    }
+    if( fgets( head, sizeof( head ), in_file ) == NULL
+            || sscanf( head, SIA_ARCHIVE_MAGIC " %d %d %15s %15s %d",
+                &version, &count, format, mode, &entry_len ) != 5
+            || version != SIA_ARCHIVE_VERSION
+            || entry_len <= 2 * ( SIA_ARCHIVE_NUM_LEN + 1 ) + 1 ) {
+        fclose( in_file );
+        return -1;
+    }
+    toc = ftell( in_file );
+
+    // bisection of the sorted table of contents, the graphs are not touched
+    entry = malloc( entry_len + 1 );
+    if( entry == NULL ) {
+        fclose( in_file );
+        return -1;
+    }
+    lo = 0;
+    hi = count - 1;
+    while( lo <= hi ) {
+        mid = lo + ( hi - lo ) / 2;
+        if( fseek( in_file, toc + ( long )mid * entry_len, SEEK_SET ) != 0
+                || fread( entry, 1, entry_len, in_file ) != ( size_t )entry_len )
+            break;
+        // the name is padded with spaces which are not part of a name
+        entry[entry_len - 1] = '\0';
+        entry_name = entry + 2 * ( SIA_ARCHIVE_NUM_LEN + 1 );
+        entry_name[strcspn( entry_name, " " )] = '\0';
+        cmp = strcmp( name, entry_name );
+        if( cmp == 0 ) {
+            sscanf( entry, "%ld %ld", &offset, &size );
+            break;
+        }
+        else if( cmp < 0 )
+            hi = mid - 1;
+        else
+            lo = mid + 1;
+    }
+    free( entry );
+    if( offset < 0 || size <= 0 || fseek( in_file, offset, SEEK_SET ) != 0 ) {
+        fclose( in_file );
+        return -1;
+    }
+    buf = malloc( size );
+    if( buf == NULL || fread( buf, 1, size, in_file ) != ( size_t )size ) {
+        free( buf );
+        fclose( in_file );
+        return -1;
+    }
+    fclose( in_file );
+
+    if( strcmp( mode, SIA_ARCHIVE_GZ ) == 0 ) {
+        data = smxz_inflate( buf, size, &data_len );
+        free( buf );
+        if( data == NULL ) return -1;
+    }
+    else {
+        data = buf;
+        data_len = size;
+    }
+    mem_file = fmemopen( data, data_len, "r" );
+    if( mem_file == NULL ) {
+        free( data );
+        return -1;
+    }
+    if( strcmp( format, G_FMT_GML ) == 0 )
+        res = igraph_read_graph_gml( g, mem_file );
+    else
+        res = igraph_read_graph_graphml( g, mem_file, 0 );
+    fclose( mem_file );
+    free( data );
+    return ( res == IGRAPH_SUCCESS ) ? 0 : -1;
+}
+
+/******************************************************************************/
+int smxz_read_graph( igraph_t* g, const char* path, const char* format )
+{
+    FILE* in_file;
+    int res;
+
+    in_file = smxz_fopen( path, "r" );
+    if( in_file == NULL ) {
+        printf( "Cannot open file '%s'!\n", path );
+        return -1;
+    }
+    if( strcmp( format, G_FMT_GML ) == 0 )
+        res = igraph_read_graph_gml( g, in_file );
+    else
+        res = igraph_read_graph_graphml( g, in_file, 0 );
+    fclose( in_file );
+    return ( res == IGRAPH_SUCCESS ) ? 0 : -1;
+}
+
+/******************************************************************************/
+ssize_t smxz_write( void* cookie, const char* buf, size_t size )
+{
+    if( size == 0 ) return 0;
+    return gzwrite( ( gzFile )cookie, buf, size );
+}
+
+/******************************************************************************/
+int smxz_write_graph( igraph_t* g, const char* path, const char* format )
+{
+    FILE* out_file;
+
+    out_file = smxz_fopen( path, "w" );
+    if( out_file == NULL ) {
+        printf( "Cannot open file '%s'!\n", path );
+        return -1;
+    }
+    if( strcmp( format, G_FMT_GML ) == 0 )
+        igraph_write_graph_gml( g, out_file, NULL, G_GML_HEAD );
+    else
+        igraph_write_graph_graphml( g, out_file, 0 );
+    return ( fclose( out_file ) == 0 ) ? 0 : -1;
+}
@@ -114,6 +114,8 @@ net_con_t* net_con_create( instrec_t* inst )
 virt_net_t* virt_net_create()
 {
     virt_net_t* v_net = malloc( sizeof( struct virt_net_s ) );
+    v_net->ports_closed = NULL;
+    v_net->ports_closed_last = NULL;
     return v_net;
 }
 
@@ -171,10 +173,11 @@ virt_net_t* virt_net_create_parallel( virt_net_t* v_net1, virt_net_t* v_net2 )
     v_net->inst = NULL;
     v_net->type = VNET_PARALLEL;
 
-    // alter ports
-    ports_tmp = virt_port_assign( v_net1->ports, NULL );
+    // alter ports: the operands are destroyed after the composition, hence
+    // their list elements can be reused
+    ports_tmp = virt_port_move( v_net, v_net1, NULL );
     if(v_net2 != NULL )
-        v_net->ports = virt_port_assign( v_net2->ports, ports_tmp );
+        v_net->ports = virt_port_move( v_net, v_net2, ports_tmp );
     else v_net->ports = ports_tmp;
 
     // create connection list
@@ -200,9 +203,10 @@ virt_net_t* virt_net_create_serial( virt_net_t* v_net1, virt_net_t* v_net2 )
     v_net->inst = NULL;
     v_net->type = VNET_SERIAL;
 
-    // alter ports
-    ports_tmp = virt_port_assign( v_net1->ports, NULL );
-    v_net->ports = virt_port_assign( v_net2->ports, ports_tmp );
+    // alter ports: the operands are destroyed after the composition, hence
+    // their list elements can be reused
+    ports_tmp = virt_port_move( v_net, v_net1, NULL );
+    v_net->ports = virt_port_move( v_net, v_net2, ports_tmp );
 
     // create connection list
     v_net->con = malloc( sizeof( net_con_t ) );
@@ -314,6 +318,12 @@ void virt_net_destroy( virt_net_t* v_net, bool deep )
         if( deep && ( ports->port != NULL ) ) free( ports->port );
         free( ports );
     }
+    while( v_net->ports_closed != NULL ) {
+        ports = v_net->ports_closed;
+        v_net->ports_closed = v_net->ports_closed->next;
+        if( deep && ( ports->port != NULL ) ) free( ports->port );
+        free( ports );
+    }
     // free connection vectors
     if( v_net->con != NULL ) {
         igraph_vector_ptr_destroy( &v_net->con->left );
@@ -418,7 +428,7 @@ void virt_port_add_time_bound( virt_net_t* v_net, struct timespec time,
         rate_type_t rt )
 {
     char error_msg[ CONST_ERROR_LEN ];
-    virt_port_list_t* ports = v_net->ports;
+    virt_port_list_t* ports = virt_port_first_all( v_net );
     instrec_t* inst;
     while( ports != NULL ) {
         if( ( ports->port->state < VPORT_STATE_DISABLED )
@@ -438,7 +448,7 @@ void virt_port_add_time_bound( virt_net_t* v_net, struct timespec time,
                 ports->port->ch_len = 0;
             }
         }
-        ports = ports->next;
+        ports = virt_port_next_all( v_net, ports );
     }
 }
 
@@ -467,7 +477,7 @@ virt_port_list_t* virt_port_assign( virt_port_list_t* old,
 virt_port_t* virt_port_create( port_class_t port_class, port_mode_t port_mode,
         virt_net_t* port_vnet, const char* name, symrec_t* symb,
         struct timespec time, rate_type_t rt, bool decoupled, bool is_open,
-        bool is_dynamic, int ch_len )
+        bool is_dynamic, int ch_len, int msg_size )
 {
     virt_port_t* new_port = NULL;
 
@@ -484,6 +494,7 @@ virt_port_t* virt_port_create( port_class_t port_class, port_mode_t port_mode,
     new_port->is_open = is_open;
     new_port->is_dynamic = is_dynamic;
     new_port->ch_len = ch_len;
+    new_port->msg_size = msg_size;
     new_port->edge_id = 0;
 
     return new_port;
@@ -494,7 +505,8 @@ virt_port_t* virt_port_copy( virt_port_t* port )
 {
     return virt_port_create( port->attr_class, port->attr_mode, port->v_net,
             port->name, port->symb, port->rate.time, port->rate.type,
-            port->descoupled, port->is_open, port->is_dynamic, port->ch_len );
+            port->descoupled, port->is_open, port->is_dynamic, port->ch_len,
+            port->msg_size );
 }
 
 /******************************************************************************/
@@ -522,7 +534,8 @@ virt_port_list_t* virt_ports_copy_symb( symrec_list_t* ports,
                 ports->rec->attr_port->decoupled,
                 ports->rec->attr_port->is_open,
                 ports->rec->attr_port->is_dynamic,
-                ports->rec->attr_port->ch_len );
+                ports->rec->attr_port->ch_len,
+                ports->rec->attr_port->msg_size );
         if( v_net_i != NULL ) {
             // for wrappers, propagate the port symbol of the child nets
             port_net = virt_port_get_equivalent_in_wrap( v_net_i, new_port );
@@ -562,7 +575,8 @@ virt_port_list_t* virt_ports_copy_vnet( virt_port_list_t* ports,
                     ports->port->descoupled,
                     ports->port->is_open,
                     ports->port->is_dynamic,
-                    ports->port->ch_len );
+                    ports->port->ch_len,
+                    ports->port->msg_size );
             if( copy_status ) new_port->state = ports->port->state;
             new_list->port = new_port;
             new_list->next = list_last;
@@ -575,11 +589,18 @@ virt_port_list_t* virt_ports_copy_vnet( virt_port_list_t* ports,
     return new_list;
 }
 
+/******************************************************************************/
+virt_port_list_t* virt_port_first_all( virt_net_t* v_net )
+{
+    if( v_net->ports != NULL ) return v_net->ports;
+    return v_net->ports_closed;
+}
+
 /******************************************************************************/
 virt_port_t* virt_port_get_equivalent( virt_net_t* v_net, virt_port_t* port,
         bool all )
 {
-    virt_port_list_t* ports = v_net->ports;
+    virt_port_list_t* ports = virt_port_first_all( v_net );
     while( ports != NULL ) {
         if( ( port->symb == ports->port->symb ) && ( all
                     || ( ports->port->state <= VPORT_STATE_CP_OPEN ) ) ) {
@@ -592,7 +613,7 @@ virt_port_t* virt_port_get_equivalent( virt_net_t* v_net, virt_port_t* port,
 #endif // DEBUG
             return ports->port;
         }
-        ports = ports->next;
+        ports = virt_port_next_all( v_net, ports );
     }
     return NULL;
 }
@@ -602,7 +623,7 @@ virt_port_t* virt_port_get_equivalent_by_symb_attr( virt_net_t* v_net,
         symrec_t* port )
 {
     virt_port_t* vp_net = NULL;
-    virt_port_list_t* ports = v_net->ports;
+    virt_port_list_t* ports = virt_port_first_all( v_net );
 #if defined(DEBUG) || defined(DEBUG_SEARCH_PORT_WRAP)
     printf( "virt_port_get_equivalent_by_symb_attr: Search port " );
     debug_print_rport( port, "UNDEF" );
@@ -620,7 +641,7 @@ virt_port_t* virt_port_get_equivalent_by_symb_attr( virt_net_t* v_net,
             if( vp_net->v_net->type == VNET_SYNC ) break;
             /* break; */
         }
-        ports = ports->next;
+        ports = virt_port_next_all( v_net, ports );
     }
 #if defined(DEBUG) || defined(DEBUG_SEARCH_PORT_WRAP)
     printf( "Found port: " );
@@ -642,7 +663,7 @@ virt_port_t* virt_port_get_equivalent_in_wrap( virt_net_t* v_net,
     debug_print_vports( v_net );
 #endif // DEBUG
     virt_port_t* port_net = NULL;
-    virt_port_list_t* ports = v_net->ports;
+    virt_port_list_t* ports = virt_port_first_all( v_net );
     while( ports != NULL ) {
         if( are_port_names_ok( ports->port, port )
                 && are_port_modes_ok( ports->port, port, true ) ) {
@@ -654,11 +675,78 @@ virt_port_t* virt_port_get_equivalent_in_wrap( virt_net_t* v_net,
 #endif // DEBUG
             if( port_net->v_net->inst->type == INSTREC_SYNC ) break;
         }
-        ports = ports->next;
+        ports = virt_port_next_all( v_net, ports );
     }
     return port_net;
 }
 
+/******************************************************************************/
+virt_port_list_t* virt_port_move( virt_net_t* v_net, virt_net_t* v_net_src,
+        virt_port_list_t* list_last )
+{
+    virt_port_list_t* list = v_net_src->ports;
+    virt_port_list_t* next = NULL;
+    int idx = 0;
+    if( list_last != NULL) idx = list_last->idx + 1;
+
+    while( list != NULL ) {
+        next = list->next;
+        if( list->port->state < VPORT_STATE_CONNECTED ) {
+            list->next = list_last;
+            list->idx = idx;
+            idx++;
+            list_last = list;
+        }
+        else {
+            // closed ports are only searched by name, keep them aside
+            list->next = NULL;
+            if( v_net->ports_closed_last != NULL )
+                v_net->ports_closed_last->next = list;
+            else v_net->ports_closed = list;
+            v_net->ports_closed_last = list;
+        }
+        list = next;
+    }
+    if( v_net_src->ports_closed != NULL ) {
+        if( v_net->ports_closed_last != NULL )
+            v_net->ports_closed_last->next = v_net_src->ports_closed;
+        else v_net->ports_closed = v_net_src->ports_closed;
+        v_net->ports_closed_last = v_net_src->ports_closed_last;
+    }
+    v_net_src->ports = NULL;
+    v_net_src->ports_closed = NULL;
+    v_net_src->ports_closed_last = NULL;
+    return list_last;
+}
+
+/******************************************************************************/
+virt_port_list_t* virt_port_next_all( virt_net_t* v_net,
+        virt_port_list_t* ports )
+{
+    if( ports->next != NULL ) return ports->next;
+    if( ports == v_net->ports_closed_last ) return NULL;
+    return v_net->ports_closed;
+}
+
+/******************************************************************************/
+void virt_port_remove( virt_net_t* v_net, virt_port_t* port )
+{
+    virt_port_list_t* list_last = NULL;
+    virt_port_list_t* list = v_net->ports;
+
+    while( list != NULL ) {
+        if( list->port == port ) {
+            if( list_last != NULL ) list_last->next = list->next;
+            else v_net->ports = list->next;
+            free( list->port );
+            free( list );
+            return;
+        }
+        list_last = list;
+        list = list->next;
+    }
+}
+
 /******************************************************************************/
 void virt_port_update_inst( virt_port_t* port, virt_net_t* v_net )
 {
@@ -671,27 +759,48 @@ void virt_port_update_inst( virt_port_t* port, virt_net_t* v_net )
 }
 
 /******************************************************************************/
-void debug_print_vport( virt_port_t* port )
+void debug_fprint_vport( FILE* out, virt_port_t* port )
 {
-    if( port->state == VPORT_STATE_CONNECTED ) printf("+");
-    else if( port->state == VPORT_STATE_CP_OPEN ) printf("-");
-    else if( port->state == VPORT_STATE_DISABLED ) printf("!");
-    else if( port->is_open ) printf("/");
-    if( port->v_net->inst == NULL ) printf( "UNDEF" );
-    else printf( "%s(%d)", port->v_net->inst->name, port->v_net->inst->id );
-    if( port->attr_class == PORT_CLASS_DOWN ) printf( "_" );
-    else if( port->attr_class == PORT_CLASS_UP ) printf( "^" );
-    else if( port->attr_class == PORT_CLASS_SIDE ) printf( "|" );
+    if( port->state == VPORT_STATE_CONNECTED ) fprintf( out, "+" );
+    else if( port->state == VPORT_STATE_CP_OPEN ) fprintf( out, "-" );
+    else if( port->state == VPORT_STATE_DISABLED ) fprintf( out, "!" );
+    else if( port->is_open ) fprintf( out, "/" );
+    if( port->v_net->inst == NULL ) fprintf( out, "UNDEF" );
+    else fprintf( out, "%s(%d)", port->v_net->inst->name,
+            port->v_net->inst->id );
+    if( port->attr_class == PORT_CLASS_DOWN ) fprintf( out, "_" );
+    else if( port->attr_class == PORT_CLASS_UP ) fprintf( out, "^" );
+    else if( port->attr_class == PORT_CLASS_SIDE ) fprintf( out, "|" );
     if( port->descoupled )
-        printf("d");
+        fprintf( out, "d" );
     if( port->attr_mode == PORT_MODE_IN ) {
-        printf( "<--" );
+        fprintf( out, "<--" );
         if( port->rate.time.tv_sec > 0 )
-            printf( "[%lus]", port->rate.time.tv_sec );
+            fprintf( out, "[%lus]", port->rate.time.tv_sec );
+    }
+    else if( port->attr_mode == PORT_MODE_OUT ) fprintf( out, "-->" );
+    else fprintf( out, "<->" );
+    fprintf( out, "%s", port->name );
+}
+
+/******************************************************************************/
+void debug_fprint_vports_s( FILE* out, virt_net_t* v_net, bool all )
+{
+    virt_port_list_t* ports = virt_port_first_all( v_net );
+    while( ports != NULL ) {
+        if( all || ( ports->port->state < VPORT_STATE_CONNECTED ) ) {
+            debug_fprint_vport( out, ports->port );
+            fprintf( out, "\n  " );
+        }
+        ports = virt_port_next_all( v_net, ports );
     }
-    else if( port->attr_mode == PORT_MODE_OUT ) printf( "-->" );
-    else printf( "<->" );
-    printf( "%s", port->name );
+    fprintf( out, "\n" );
+}
+
+/******************************************************************************/
+void debug_print_vport( virt_port_t* port )
+{
+    debug_fprint_vport( stdout, port );
 }
 
 /******************************************************************************/
@@ -703,15 +812,5 @@ void debug_print_vports( virt_net_t* v_net )
 /******************************************************************************/
 void debug_print_vports_s( virt_net_t* v_net, bool all )
 {
-    virt_port_list_t* ports = NULL;
-    if( v_net->ports != NULL )
-        ports = v_net->ports;
-    while( ports != NULL ) {
-        if( all || ( ports->port->state < VPORT_STATE_CONNECTED ) ) {
-            debug_print_vport( ports->port );
-            printf("\n  ");
-        }
-        ports = ports->next;
-    }
-    printf("\n");
+    debug_fprint_vports_s( stdout, v_net, all );
 }
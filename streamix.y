@@ -10,6 +10,7 @@
 /* Prologue */
     #include "ast.h"
     #include "defines.h"
+    #include "smxerr.h"
     #include <stdio.h>
     extern int yylex();
     extern void yyerror ( void**, const char* );
@@ -65,6 +66,7 @@
 %type <nval> alt_port_decl
 %type <nval> opt_alt_ports
 %type <nval> opt_channel_len
+%type <nval> opt_msg_size
 %type <nval> opt_alt_port_name
 
 /* lists */
@@ -84,6 +86,7 @@
 %left '!'
 %left ':'
 %left '.'
+%precedence '*'
 %start start
 
 %%
@@ -143,6 +146,17 @@ net:
 |   net ':' net { $$ = ast_add_op( $1, $3, AST_SERIAL_PROP ); }
 |   net '!' net { $$ = ast_add_op( $1, $3, AST_PARALLEL ); }
 |   net '|' net { $$ = ast_add_op( $1, $3, AST_PARALLEL_DET ); }
+|   net '*' BUFLEN {
+        char error_msg[ CONST_ERROR_LEN ];
+        // the replicas are installed one by one, reject absurd widths early
+        if( $3 > CONST_FARM_MAX_WIDTH ) {
+            sprintf( error_msg, ERROR_FARM_WIDTH, ERR_ERROR,
+                    CONST_FARM_MAX_WIDTH );
+            report_yyerror( error_msg, @3.last_line );
+            $$ = $1;
+        }
+        else $$ = ast_add_farm( $1, $3, @3.last_line );
+    }
 |   '(' net ')' { $$ = $2; }
 |   RT '(' net ')' {
         struct timespec time;
@@ -193,6 +207,7 @@ net_port_decl:
             $2,
             ( ast_node_t* )0, // no coupling
             ( ast_node_t* )0, // no channel length
+            ( ast_node_t* )0, // no message size
             ( ast_node_t* )0, // cannot be open or dynamic
             PORT_NET
         );
@@ -225,7 +240,7 @@ opt_box_port_list:
 ;
 
 box_port_decl:
-    kw_opt_decoupled kw_opt_port_class kw_port_mode IDENTIFIER opt_alt_port_name opt_channel_len kw_opt_connection {
+    kw_opt_decoupled kw_opt_port_class kw_port_mode IDENTIFIER opt_alt_port_name opt_channel_len opt_msg_size kw_opt_connection {
         $$ = ast_add_port(
             ast_add_symbol( $4, @4.last_line, ID_PORT ),
             $5, // alternative port name
@@ -233,7 +248,8 @@ box_port_decl:
             $3, // port mode
             $1, // port coupling
             $6, // channel length
-            $7, // connection attr
+            $7, // message size
+            $8, // connection attr
             PORT_BOX
         );
     }
@@ -249,6 +265,11 @@ opt_channel_len:
 |   '[' BUFLEN ']' { $$ = ast_add_attr( $2, ATTR_INT ); }
 ;
 
+opt_msg_size:
+    %empty { $$ = ( ast_node_t* )0; }
+|   '<' BUFLEN '>' { $$ = ast_add_attr( $2, ATTR_INT ); }
+;
+
 /* wrapper declaration */
 wrap_decl:
     kw_opt_static WRAPPER IDENTIFIER '(' wrap_port_list ')' '{' program '}'
@@ -285,6 +306,7 @@ wrap_port_decl:
             $3,
             $1, // port coupling
             ( ast_node_t* )0, // no channel length
+            ( ast_node_t* )0, // no message size
             ( ast_node_t* )0, // cannot be open nor dynamic
             PORT_WRAP
         );
@@ -298,6 +320,7 @@ wrap_port_decl:
             ( ast_node_t* )0, // no mode
             ( ast_node_t* )0, // no coupling
             ( ast_node_t* )0, // no channel length
+            ( ast_node_t* )0, // no message size
             ( ast_node_t* )0, // cannot be open nor dynamic
             PORT_WRAP_NULL
         );
@@ -335,6 +358,7 @@ alt_port_decl:
             ( ast_node_t* )0, // no mode
             ( ast_node_t* )0, // no coupling
             ( ast_node_t* )0, // no channel length
+            ( ast_node_t* )0, // no message size
             ( ast_node_t* )0, // cannot be open nor dynamic
             PORT_BOX
         );
@@ -42,7 +42,7 @@ attr_net_t* symrec_attr_create_net( virt_net_t* v_net, igraph_t* g )
 /******************************************************************************/
 attr_port_t* symrec_attr_create_port( symrec_list_t* port_int, port_mode_t mode,
         port_class_t collection, bool decoupled, bool is_open, bool is_dynamic,
-        int ch_len )
+        int ch_len, int msg_size )
 {
     attr_port_t* new_attr = malloc( sizeof( attr_port_t ) );
     new_attr->ports_int = port_int;
@@ -52,6 +52,7 @@ attr_port_t* symrec_attr_create_port( symrec_list_t* port_int, port_mode_t mode,
     new_attr->is_open = is_open;
     new_attr->is_dynamic = is_dynamic;
     new_attr->ch_len = ch_len;
+    new_attr->msg_size = msg_size;
     new_attr->alt_name = NULL;
     return new_attr;
 }
@@ -97,6 +98,7 @@ void symrec_attr_destroy_net( attr_net_t* attr, bool deep )
 void symrec_attr_destroy_port( attr_port_t* attr )
 {
     symrec_list_del( attr->ports_int );
+    free( attr->alt_name );
     free( attr );
 }
 
@@ -334,26 +336,39 @@ symrec_t* symrec_search( symrec_t** symtab, UT_array* scope_stack, char *name,
 }
 
 /******************************************************************************/
-void debug_print_rport( symrec_t* port, char* name )
+void debug_fprint_rport( FILE* out, symrec_t* port, char* name )
 {
-    printf( "%s", name );
-    if( port->attr_port->collection == PORT_CLASS_DOWN ) printf( "_" );
-    else if( port->attr_port->collection == PORT_CLASS_UP ) printf( "^" );
-    else if( port->attr_port->collection == PORT_CLASS_SIDE ) printf( "|" );
-    if( port->attr_port->mode == PORT_MODE_IN ) printf( "<--" );
-    else if( port->attr_port->mode == PORT_MODE_OUT ) printf( "-->" );
-    else printf( "<->" );
-    printf( "%s", port->name );
+    fprintf( out, "%s", name );
+    if( port->attr_port->collection == PORT_CLASS_DOWN ) fprintf( out, "_" );
+    else if( port->attr_port->collection == PORT_CLASS_UP ) fprintf( out, "^" );
+    else if( port->attr_port->collection == PORT_CLASS_SIDE )
+        fprintf( out, "|" );
+    if( port->attr_port->mode == PORT_MODE_IN ) fprintf( out, "<--" );
+    else if( port->attr_port->mode == PORT_MODE_OUT ) fprintf( out, "-->" );
+    else fprintf( out, "<->" );
+    fprintf( out, "%s", port->name );
 }
 
 /******************************************************************************/
-void debug_print_rports( symrec_list_t* rports, char* name )
+void debug_fprint_rports( FILE* out, symrec_list_t* rports, char* name )
 {
     symrec_list_t* ports = rports;
     while( ports != NULL ) {
-        debug_print_rport( ports->rec, name );
-        printf("\n  ");
+        debug_fprint_rport( out, ports->rec, name );
+        fprintf( out, "\n  " );
         ports = ports->next;
     }
-    printf("\n");
+    fprintf( out, "\n" );
+}
+
+/******************************************************************************/
+void debug_print_rport( symrec_t* port, char* name )
+{
+    debug_fprint_rport( stdout, port, name );
+}
+
+/******************************************************************************/
+void debug_print_rports( symrec_list_t* rports, char* name )
+{
+    debug_fprint_rports( stdout, rports, name );
 }
@@ -28,6 +28,7 @@ typedef enum location_type_e location_type_t; /**< ::location_type_e */
 
 // INCLUDES -------------------------------------------------------------------
 #include <stdbool.h>
+#include <stdio.h>
 #include "uthash.h"
 #include "utarray.h"
 #include "vnet.h"
@@ -108,7 +109,9 @@ struct attr_port_s
     bool            is_open;        /**< whether the port is unconnected */
     bool            is_dynamic;     /**< whether the port is created dynamically */
     int             ch_len;         /**< length of the channel */
-    const char*     alt_name;       /**< alternative name of the port */
+    int             msg_size;       /**< size of a message in bytes or 0 if
+                                         not declared */
+    char*           alt_name;       /**< alternative name of the port */
 };
 
 /**
@@ -167,11 +170,12 @@ attr_net_t* symrec_attr_create_net( virt_net_t* v_net, igraph_t* g );
  * @param is_open       flag indication whther a port is open
  * @param is_dynamic    flag indication whther a port is dynamic
  * @param ch_len        length of the channel
+ * @param msg_size      size of a message in bytes or 0 if not declared
  * @return              pointer to the new structure
  */
 attr_port_t* symrec_attr_create_port( symrec_list_t* port_int, port_mode_t mode,
         port_class_t collection, bool decoupled, bool is_open, bool is_dynamic,
-        int ch_len );
+        int ch_len, int msg_size );
 
 /**
  * @brief   Create a net prototype attribute structure
@@ -384,6 +388,25 @@ symrec_t* symrec_put( symrec_t** symtab, symrec_t* new_item );
 symrec_t* symrec_search( symrec_t** symtab, UT_array* scope_stack, char* name,
         int attr_key );
 
+/**
+ * @brief   Write debug information of a port of a port record list to a stream
+ *
+ * @param out   file handler to write to
+ * @param port  pointer to the port record
+ * @param name  name of the net instance to port belongs to
+ */
+void debug_fprint_rport( FILE* out, symrec_t* port, char* name );
+
+/**
+ * @brief   Write debug information of all ports in a port record list to a
+ *          stream
+ *
+ * @param out       file handler to write to
+ * @param rports    pointer to the port record list
+ * @param name      name of the net instance to port belongs to
+ */
+void debug_fprint_rports( FILE* out, symrec_list_t* rports, char* name );
+
 /**
  * @brief   Print debug information of a port of a port record list
  *
@@ -0,0 +1,120 @@
+/**
+ * Round trip test of the SIA archive
+ *
+ * Each SIA file written by smxc without '-a' is read with smxz_read_graph()
+ * and compared to the SIA of the same name read from the archive with
+ * smxz_read_archive(). The archive must hold exactly the given SIAs and a
+ * name which is not in the archive must not be found.
+ *
+ * usage: test/archive_read ARCHIVE SIA_FILE...
+ * build and run from the project root with 'make run_test_archive'
+ *
+ * @file    archive_read.c
+ *
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <libgen.h>
+#include "smxz.h"
+
+/******************************************************************************/
+char* archive_read_gml( igraph_t* g )
+{
+    FILE* mem_file;
+    char* buf = NULL;
+    size_t buf_len;
+
+    mem_file = open_memstream( &buf, &buf_len );
+    if( mem_file == NULL ) return NULL;
+    // a fixed creator, the default one holds the time of writing
+    igraph_write_graph_gml( g, mem_file, NULL, "archive_read" );
+    fclose( mem_file );
+    return buf;
+}
+
+/******************************************************************************/
+int archive_read_check( const char* archive, const char* path )
+{
+    igraph_t g_file, g_archive;
+    char* file_name = strdup( path );
+    char* name = basename( file_name );
+    const char* format = smxz_format( path );
+    char* gml_file;
+    char* gml_archive;
+    int err = 0;
+
+    // the streamix name is the file name without the extensions
+    name[strcspn( name, "." )] = '\0';
+    if( format == NULL || smxz_read_graph( &g_file, path, format ) != 0 ) {
+        fprintf( stderr, "%s: cannot read the SIA file\n", path );
+        free( file_name );
+        return 1;
+    }
+    if( smxz_read_archive( &g_archive, archive, name ) != 0 ) {
+        fprintf( stderr, "%s: SIA '%s' is not in the archive\n", archive,
+                name );
+        igraph_destroy( &g_file );
+        free( file_name );
+        return 1;
+    }
+    gml_file = archive_read_gml( &g_file );
+    gml_archive = archive_read_gml( &g_archive );
+    if( gml_file == NULL || gml_archive == NULL
+            || strcmp( gml_file, gml_archive ) != 0 ) {
+        fprintf( stderr, "%s: SIA '%s' differs from the archive\n", path,
+                name );
+        err = 1;
+    }
+    free( gml_file );
+    free( gml_archive );
+    igraph_destroy( &g_file );
+    igraph_destroy( &g_archive );
+    free( file_name );
+    return err;
+}
+
+/******************************************************************************/
+int main( int argc, char **argv )
+{
+    FILE* in_file;
+    igraph_t g;
+    int i, count = -1, err = 0;
+
+    if( argc < 3 ) {
+        fprintf( stderr, "usage: %s ARCHIVE SIA_FILE...\n", argv[0] );
+        return 1;
+    }
+    igraph_i_set_attribute_table( &igraph_cattribute_table );
+
+    in_file = fopen( argv[1], "r" );
+    if( in_file == NULL
+            || fscanf( in_file, SIA_ARCHIVE_MAGIC " %*d %d", &count ) != 1 ) {
+        fprintf( stderr, "%s: cannot read the archive\n", argv[1] );
+        if( in_file != NULL ) fclose( in_file );
+        return 1;
+    }
+    fclose( in_file );
+    if( count != argc - 2 ) {
+        fprintf( stderr, "%s: %d SIA(s) in the archive, %d expected\n",
+                argv[1], count, argc - 2 );
+        err++;
+    }
+
+    for( i = 2; i < argc; i++ )
+        err += archive_read_check( argv[1], argv[i] );
+
+    // names before, between, and after the entries of the table
+    if( smxz_read_archive( &g, argv[1], "" ) == 0
+            || smxz_read_archive( &g, argv[1], "smx_missing" ) == 0
+            || smxz_read_archive( &g, argv[1], "~" ) == 0 ) {
+        fprintf( stderr, "%s: a missing SIA was found\n", argv[1] );
+        igraph_destroy( &g );
+        err++;
+    }
+
+    printf( "%s: %d SIA(s) checked, %d error(s)\n", argv[1], argc - 2, err );
+    return ( err > 0 );
+}
@@ -0,0 +1,85 @@
+/**
+ * Static setup of the streamix network 'cgen1'
+ *
+ * Generated by smxc, do not edit.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifndef SMX_CGEN_TYPES
+#define SMX_CGEN_TYPES
+typedef int ( *smx_cgen_impl_t )( void*, void* );
+
+typedef struct smx_cgen_time_s
+{
+    long tv_sec;
+    long tv_nsec;
+} smx_cgen_time_t;
+
+typedef struct smx_cgen_channel_s
+{
+    const char* name;
+    int len;
+    bool is_decoupled_src;
+    bool is_decoupled_dst;
+    bool is_dynamic_src;
+    bool is_dynamic_dst;
+    int rate_type;
+    int ch_class;
+    smx_cgen_time_t time_src;
+    smx_cgen_time_t time_dst;
+    int box_src;
+    int box_dst;
+} smx_cgen_channel_t;
+
+typedef struct smx_cgen_box_s
+{
+    const char* name;
+    const smx_cgen_impl_t* stages;
+    int stage_cnt;
+    int prio;
+    bool is_pure;
+    bool is_static;
+    int location;
+    int in_first;
+    int in_cnt;
+    int out_first;
+    int out_cnt;
+} smx_cgen_box_t;
+#endif /* SMX_CGEN_TYPES */
+
+extern int fa( void*, void* );
+extern int fb( void*, void* );
+extern int fd( void*, void* );
+extern int fc( void*, void* );
+extern int smx_rn( void*, void* );
+
+const int smx_cgen_box_in[] = {
+    2, 0, 1, 3,
+};
+
+const int smx_cgen_box_out[] = {
+    3, 0, 2, 1,
+};
+
+const smx_cgen_impl_t smx_cgen_stages[] = {
+    fa, fb, fd, fc, smx_rn,
+};
+
+const smx_cgen_channel_t smx_cgen_channels[] = {
+    { "y", 1, 0, 0, 0, 0, 1, 0, { 0, 0 }, { 0, 10000000 }, 1, 2 },
+    { "x", 1, 0, 0, 0, 0, 0, 0, { 0, 0 }, { 0, 0 }, 4, 3 },
+    { "x", 1, 0, 1, 0, 0, 0, 0, { 0, 0 }, { 0, 0 }, 4, 1 },
+    { "x", 1, 0, 0, 0, 0, 0, 0, { 0, 0 }, { 0, 0 }, 0, 4 },
+};
+const int smx_cgen_channel_cnt = 4;
+
+const smx_cgen_box_t smx_cgen_boxes[] = {
+    { "A", smx_cgen_stages + 0, 1, 0, 0, 0, 0, 0, 0, 0, 1 },
+    { "B", smx_cgen_stages + 1, 1, 0, 0, 0, 0, 0, 1, 1, 1 },
+    { "D", smx_cgen_stages + 2, 1, 3, 0, 0, 0, 1, 1, 2, 0 },
+    { "C", smx_cgen_stages + 3, 1, 0, 0, 0, 0, 2, 1, 2, 0 },
+    { "smx_rn", smx_cgen_stages + 4, 1, 0, 0, 0, 0, 3, 1, 2, 2 },
+};
+const int smx_cgen_box_cnt = 5;
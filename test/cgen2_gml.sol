@@ -0,0 +1,83 @@
+/**
+ * Static setup of the streamix network 'cgen2'
+ *
+ * Generated by smxc, do not edit.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifndef SMX_CGEN_TYPES
+#define SMX_CGEN_TYPES
+typedef int ( *smx_cgen_impl_t )( void*, void* );
+
+typedef struct smx_cgen_time_s
+{
+    long tv_sec;
+    long tv_nsec;
+} smx_cgen_time_t;
+
+typedef struct smx_cgen_channel_s
+{
+    const char* name;
+    int len;
+    bool is_decoupled_src;
+    bool is_decoupled_dst;
+    bool is_dynamic_src;
+    bool is_dynamic_dst;
+    int rate_type;
+    int ch_class;
+    smx_cgen_time_t time_src;
+    smx_cgen_time_t time_dst;
+    int box_src;
+    int box_dst;
+} smx_cgen_channel_t;
+
+typedef struct smx_cgen_box_s
+{
+    const char* name;
+    const smx_cgen_impl_t* stages;
+    int stage_cnt;
+    int prio;
+    bool is_pure;
+    bool is_static;
+    int location;
+    int in_first;
+    int in_cnt;
+    int out_first;
+    int out_cnt;
+} smx_cgen_box_t;
+#endif /* SMX_CGEN_TYPES */
+
+extern int A( void*, void* );
+extern int B( void*, void* );
+extern int C( void*, void* );
+extern int D( void*, void* );
+extern int E( void*, void* );
+extern int F( void*, void* );
+
+const int smx_cgen_box_in[] = {
+    0, 2, 1,
+};
+
+const int smx_cgen_box_out[] = {
+    0, 2, 1,
+};
+
+const smx_cgen_impl_t smx_cgen_stages[] = {
+    A, B, C, D, E, F,
+};
+
+const smx_cgen_channel_t smx_cgen_channels[] = {
+    { "a", 1, 0, 0, 0, 0, 0, 0, { 0, 0 }, { 0, 0 }, 0, 1 },
+    { "e", 1, 0, 0, 0, 0, 0, 0, { 0, 0 }, { 0, 0 }, 1, 2 },
+    { "f", 1, 0, 0, 0, 0, 0, 0, { 0, 0 }, { 0, 0 }, 1, 2 },
+};
+const int smx_cgen_channel_cnt = 3;
+
+const smx_cgen_box_t smx_cgen_boxes[] = {
+    { "A", smx_cgen_stages + 0, 1, 0, 0, 0, 0, 0, 0, 0, 1 },
+    { "B,C,D,E", smx_cgen_stages + 1, 4, 0, 1, 0, 0, 0, 1, 1, 2 },
+    { "F", smx_cgen_stages + 5, 1, 0, 0, 0, 0, 1, 2, 3, 0 },
+};
+const int smx_cgen_box_cnt = 3;
@@ -12,6 +12,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -22,6 +24,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -32,6 +36,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 2
+    fanout 1
   ]
   node
   [
@@ -42,6 +48,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -52,6 +60,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -62,6 +72,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   edge
   [
@@ -80,6 +92,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -98,6 +112,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -116,6 +132,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -134,5 +152,7 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
 ]
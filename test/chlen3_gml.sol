@@ -12,6 +12,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -22,6 +24,8 @@ graph
     pure 0
     location 0
     tt 3
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -32,6 +36,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -42,6 +48,8 @@ graph
     pure 0
     location 0
     tt 3
+    fanin 1
+    fanout 1
   ]
   edge
   [
@@ -60,6 +68,8 @@ graph
     type 1
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -78,5 +88,7 @@ graph
     type 1
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
 ]
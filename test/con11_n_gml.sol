@@ -3,56 +3,4 @@ Version 1
 graph
 [
   directed 1
-  node
-  [
-    id 0
-    label "A"
-    func "A"
-    static 0
-    pure 0
-    location 0
-    tt 0
-  ]
-  node
-  [
-    id 1
-    label "B"
-    func "B"
-    static 0
-    pure 0
-    location 0
-    tt 0
-  ]
-  edge
-  [
-    source 0
-    target 1
-    label "y"
-    nsrc "smx_null"
-    ndst "smx_null"
-    dsrc 0
-    ddst 1
-    len 1
-    dts 0
-    dtns 0
-    sts 0
-    stns 0
-    type 0
-  ]
-  edge
-  [
-    source 0
-    target 1
-    label "x"
-    nsrc "smx_null"
-    ndst "smx_null"
-    dsrc 0
-    ddst 1
-    len 1
-    dts 0
-    dtns 0
-    sts 0
-    stns 0
-    type 0
-  ]
 ]
@@ -1,4 +1,3 @@
 test/con13_n.smx: 5: error: nondeterminism on deterministic operation 'A|A', use '!' instead
 test/con13_n.smx: 8: error: no port connection in serial combinition 'A(*).B(*)'
-test/con13_n.smx: 8: error: port 'x' in 'A'(*) is not connected
- Error count: 3
+ Error count: 2
@@ -12,6 +12,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -22,6 +24,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -32,6 +36,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   edge
   [
@@ -50,6 +56,8 @@ graph
     type 0
     dynsrc 1
     dyndst 1
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -68,5 +76,7 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
 ]
@@ -1,3 +1,2 @@
 test/con8_n.smx: 8: error: no port connection in serial combinition 'B(*).A(*)'
-test/con8_n.smx: 8: error: port 'a' in 'A'(*) is not connected
- Error count: 2
+ Error count: 1
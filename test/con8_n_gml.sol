@@ -1,54 +0,0 @@
-Creator "igraph version 0.7.1 StreamixC"
-Version 1
-graph
-[
-  directed 1
-  node
-  [
-    id 0
-    label "A"
-    func "fA"
-    static 0
-    pure 0
-    location 0
-    tt 0
-  ]
-  node
-  [
-    id 1
-    label "B"
-    func "fB"
-    static 0
-    pure 0
-    location 0
-    tt 0
-  ]
-  node
-  [
-    id 2
-    label "A"
-    func "fA"
-    static 0
-    pure 0
-    location 0
-    tt 0
-  ]
-  edge
-  [
-    source 0
-    target 1
-    label "a"
-    nsrc "smx_null"
-    ndst "smx_null"
-    dsrc 0
-    ddst 0
-    len 1
-    dts 0
-    dtns 0
-    sts 0
-    stns 0
-    type 0
-    dynsrc 0
-    dyndst 0
-  ]
-]
@@ -1,3 +1,2 @@
 test/con9_n.smx: 10: error: no port connection in serial combinition 'A(*).B(*)'
-test/con9_n.smx: 10: error: port 'a' in 'A'(*) is not connected
- Error count: 2
+ Error count: 1
@@ -12,6 +12,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -22,6 +24,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -32,6 +36,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -42,6 +48,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 2
   ]
   node
   [
@@ -52,6 +60,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -62,6 +72,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -72,6 +84,8 @@ graph
     pure 1
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -82,6 +96,8 @@ graph
     pure 1
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -92,6 +108,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -102,6 +120,8 @@ graph
     pure 1
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -112,6 +132,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -122,6 +144,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 2
   ]
   node
   [
@@ -132,6 +156,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -142,6 +168,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -152,6 +180,8 @@ graph
     pure 1
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -162,6 +192,8 @@ graph
     pure 1
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -172,6 +204,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -182,6 +216,8 @@ graph
     pure 1
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -192,6 +228,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -202,6 +240,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 2
   ]
   node
   [
@@ -212,6 +252,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -222,6 +264,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -232,6 +276,8 @@ graph
     pure 1
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -242,6 +288,8 @@ graph
     pure 1
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -252,6 +300,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -262,6 +312,8 @@ graph
     pure 1
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   edge
   [
@@ -280,6 +332,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 1
   ]
   edge
   [
@@ -298,6 +352,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -316,6 +372,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -334,6 +392,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 1
   ]
   edge
   [
@@ -352,6 +412,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -370,6 +432,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -388,6 +452,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -406,6 +472,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -424,6 +492,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -442,6 +512,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -460,6 +532,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -478,6 +552,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 1
   ]
   edge
   [
@@ -496,6 +572,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -514,6 +592,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -532,6 +612,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 1
   ]
   edge
   [
@@ -550,6 +632,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -568,6 +652,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -586,6 +672,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -604,6 +692,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -622,6 +712,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -640,6 +732,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -658,6 +752,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -676,6 +772,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 1
   ]
   edge
   [
@@ -694,6 +792,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -712,6 +812,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -730,6 +832,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 1
   ]
   edge
   [
@@ -748,6 +852,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -766,6 +872,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -784,6 +892,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -802,6 +912,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -820,6 +932,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -838,6 +952,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -856,6 +972,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -874,6 +992,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 1
   ]
   edge
   [
@@ -892,6 +1012,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 1
   ]
   edge
   [
@@ -910,6 +1032,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 1
   ]
   edge
   [
@@ -928,6 +1052,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -946,6 +1072,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 1
   ]
   edge
   [
@@ -964,6 +1092,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 1
   ]
   edge
   [
@@ -982,6 +1112,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 1
   ]
   edge
   [
@@ -1000,5 +1132,7 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
 ]
@@ -0,0 +1,2 @@
+ Graph diff: 2 vertex(es) added, 2 removed, 0 modified; 3 channel(s) added, 3 removed, 1 modified
+ Graph diff written to './/diff1_diff.json'
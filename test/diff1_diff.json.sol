@@ -0,0 +1,33 @@
+{
+  "vertices": {
+    "added": [
+      { "id": 3, "key": "E@12" },
+      { "id": 4, "key": "smx_rn(in:A@12.x,out:B@12.x,out:E@12.x)" }
+    ],
+    "removed": [
+      { "old_id": 3, "key": "D@12" },
+      { "old_id": 4, "key": "smx_rn(in:A@12.x,out:B@12.x,out:D@12.x)" }
+    ],
+    "modified": [
+    ],
+    "moved": [
+    ]
+  },
+  "channels": {
+    "added": [
+      { "id": 1, "key": "smx_rn(in:A@12.x,out:B@12.x,out:E@12.x):x>E@12" },
+      { "id": 2, "key": "smx_rn(in:A@12.x,out:B@12.x,out:E@12.x):x>B@12" },
+      { "id": 3, "key": "A@12:x>smx_rn(in:A@12.x,out:B@12.x,out:E@12.x)" }
+    ],
+    "removed": [
+      { "old_id": 1, "key": "smx_rn(in:A@12.x,out:B@12.x,out:D@12.x):x>D@12" },
+      { "old_id": 2, "key": "smx_rn(in:A@12.x,out:B@12.x,out:D@12.x):x>B@12" },
+      { "old_id": 3, "key": "A@12:x>smx_rn(in:A@12.x,out:B@12.x,out:D@12.x)" }
+    ],
+    "modified": [
+      { "id": 0, "old_id": 0, "key": "B@12:y>C@12", "attrs": [ "len" ] }
+    ],
+    "moved": [
+    ]
+  }
+}
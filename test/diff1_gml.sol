@@ -0,0 +1,151 @@
+Creator "igraph version 0.7.1 StreamixC"
+Version 1
+graph
+[
+  directed 1
+  node
+  [
+    id 0
+    label "A"
+    func "fa"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    path "A@12"
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 1
+    label "B"
+    func "fb"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    path "B@12"
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 2
+    label "C"
+    func "fc"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    path "C@12"
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 3
+    label "E"
+    func "fe"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    path "E@12"
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 4
+    label "smx_rn"
+    func "smx_rn"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    path "smx_rn"
+    fanin 1
+    fanout 2
+  ]
+  edge
+  [
+    source 1
+    target 2
+    label "y"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 4
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 4
+    target 3
+    label "x"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 4
+    target 1
+    label "x"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 0
+    target 4
+    label "x"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    class 0
+    decoupled 0
+  ]
+]
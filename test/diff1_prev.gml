@@ -7,46 +7,81 @@ graph
   [
     id 0
     label "A"
-    func "a"
+    func "fa"
     static 0
     pure 0
     location 0
     tt 0
+    path "A@12"
   ]
   node
   [
     id 1
     label "B"
-    func "b"
+    func "fb"
     static 0
     pure 0
     location 0
     tt 0
+    path "B@12"
   ]
   node
   [
     id 2
-    label "B"
-    func "b"
+    label "C"
+    func "fc"
     static 0
     pure 0
     location 0
     tt 0
+    path "C@12"
   ]
   node
   [
     id 3
+    label "D"
+    func "fd"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    path "D@12"
+  ]
+  node
+  [
+    id 4
     label "smx_rn"
     func "smx_rn"
     static 0
     pure 0
     location 0
     tt 0
+    path "smx_rn"
   ]
   edge
   [
-    source 3
+    source 1
     target 2
+    label "y"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 4
+    target 3
     label "x"
     nsrc "smx_null"
     ndst "smx_null"
@@ -60,10 +95,12 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
-    source 3
+    source 4
     target 1
     label "x"
     nsrc "smx_null"
@@ -78,5 +115,27 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 0
+    target 4
+    label "x"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    class 2
+    decoupled 0
   ]
 ]
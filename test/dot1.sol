@@ -0,0 +1,3 @@
+ DOT view 'dot/port_connection_graph.dot' reduced from 8 to 4 vertices by collapsing nets
+ DOT view 'dot/collapsed_connection_graph.dot' reduced from 8 to 4 vertices by collapsing nets
+ DOT view: collapsed graph written to 'dot/collapsed_connection_graph.dot'
@@ -0,0 +1,36 @@
+/* Created by igraph 0.7.1 */
+digraph {
+  0 [
+    label=S
+  ];
+  1 [
+    label=K
+  ];
+  2 [
+    label="M_1/N_0"
+  ];
+  3 [
+    label="M_1/N_1"
+  ];
+
+  0 -> 2 [
+    count=1
+    label="1"
+  ];
+  2 -> 2 [
+    count=2
+    label="2"
+  ];
+  2 -> 3 [
+    count=1
+    label="1"
+  ];
+  3 -> 1 [
+    count=1
+    label="1"
+  ];
+  3 -> 3 [
+    count=2
+    label="2"
+  ];
+}
@@ -0,0 +1,36 @@
+/* Created by igraph 0.7.1 */
+digraph {
+  0 [
+    label=S
+  ];
+  1 [
+    label=K
+  ];
+  2 [
+    label="M@17/N@14"
+  ];
+  3 [
+    label="M@17/N@15"
+  ];
+
+  0 -> 2 [
+    count=1
+    label="1"
+  ];
+  2 -> 2 [
+    count=2
+    label="2"
+  ];
+  2 -> 3 [
+    count=1
+    label="1"
+  ];
+  3 -> 1 [
+    count=1
+    label="1"
+  ];
+  3 -> 3 [
+    count=2
+    label="2"
+  ];
+}
@@ -0,0 +1,457 @@
+Creator "igraph version 0.7.1 StreamixC"
+Version 1
+graph
+[
+  directed 1
+  node
+  [
+    id 0
+    label "S"
+    func "fs"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    farm 0
+    replica 0
+    farmouter 0
+    replicaouter 0
+    farmrn 0
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 1
+    label "V"
+    func "fv"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    farm 0
+    replica 0
+    farmouter 0
+    replicaouter 0
+    farmrn 0
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 2
+    label "K"
+    func "fk"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    farm 0
+    replica 0
+    farmouter 0
+    replicaouter 0
+    farmrn 0
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 3
+    label "W"
+    func "fw"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    farm 1
+    replica 0
+    farmouter 0
+    replicaouter 0
+    farmrn 0
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 4
+    label "W"
+    func "fw"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    farm 1
+    replica 1
+    farmouter 0
+    replicaouter 0
+    farmrn 0
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 5
+    label "smx_rn_collect"
+    func "smx_rn_collect"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    farm 1
+    replica 0
+    farmouter 0
+    replicaouter 0
+    farmrn 2
+    fanin 2
+    fanout 1
+  ]
+  node
+  [
+    id 6
+    label "smx_rn_dispatch"
+    func "smx_rn_dispatch"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    farm 1
+    replica 0
+    farmouter 0
+    replicaouter 0
+    farmrn 1
+    fanin 1
+    fanout 2
+  ]
+  node
+  [
+    id 7
+    label "W"
+    func "fw"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    farm 2
+    replica 0
+    farmouter 0
+    replicaouter 0
+    farmrn 0
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 8
+    label "W"
+    func "fw"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    farm 2
+    replica 1
+    farmouter 0
+    replicaouter 0
+    farmrn 0
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 9
+    label "smx_rn_collect"
+    func "smx_rn_collect"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    farm 2
+    replica 0
+    farmouter 0
+    replicaouter 0
+    farmrn 2
+    fanin 2
+    fanout 1
+  ]
+  node
+  [
+    id 10
+    label "smx_rn_dispatch"
+    func "smx_rn_dispatch"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    farm 2
+    replica 0
+    farmouter 0
+    replicaouter 0
+    farmrn 1
+    fanin 1
+    fanout 2
+  ]
+  edge
+  [
+    source 3
+    target 5
+    label "y"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    farm 1
+    replica 0
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 4
+    target 5
+    label "y"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    farm 1
+    replica 1
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 6
+    target 3
+    label "x"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    farm 1
+    replica 0
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 6
+    target 4
+    label "x"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    farm 1
+    replica 1
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 5
+    target 1
+    label "y"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    farm 0
+    replica 0
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 0
+    target 6
+    label "x"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    farm 0
+    replica 0
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 7
+    target 9
+    label "y"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    farm 2
+    replica 0
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 8
+    target 9
+    label "y"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    farm 2
+    replica 1
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 10
+    target 7
+    label "x"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    farm 2
+    replica 0
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 10
+    target 8
+    label "x"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    farm 2
+    replica 1
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 9
+    target 2
+    label "y"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    farm 0
+    replica 0
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 1
+    target 10
+    label "x"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    farm 0
+    replica 0
+    class 0
+    decoupled 0
+  ]
+]
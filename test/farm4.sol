@@ -0,0 +1,4 @@
+test/farm4.smx: 14: error: width of farm exceeds the limit of 4096 replicas '4097'
+test/farm4.smx: 15: error: width of farm exceeds the limit of 4096 replicas '100000000000'
+test/farm4.smx: 17: error: width of farm exceeds the limit of 4096 replicas '4294967297'
+ Error count: 3
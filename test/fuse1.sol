@@ -0,0 +1 @@
+ Routing node fusion: 0 routing node(s) eliminated
@@ -0,0 +1,334 @@
+Creator "igraph version 0.7.1 StreamixC"
+Version 1
+graph
+[
+  directed 1
+  node
+  [
+    id 0
+    label "L"
+    func "L"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 1
+    label "R"
+    func "R"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 2
+    label "A"
+    func "A"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 3
+    label "A"
+    func "A"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 4
+    label "smx_rn"
+    func "smx_rn"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    fanin 1
+    fanout 2
+  ]
+  node
+  [
+    id 5
+    label "smx_rn"
+    func "smx_rn"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    fanin 2
+    fanout 2
+  ]
+  node
+  [
+    id 6
+    label "B"
+    func "B"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 7
+    label "C"
+    func "C"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 8
+    label "smx_rn"
+    func "smx_rn"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    fanin 1
+    fanout 1
+  ]
+  edge
+  [
+    source 4
+    target 3
+    label "a"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 4
+    target 2
+    label "a"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 3
+    target 5
+    label "p_int"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 2
+    target 5
+    label "p_int"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 5
+    target 7
+    label "p_int"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 5
+    target 6
+    label "p_int"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 6
+    target 8
+    label "b"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 8
+    target 1
+    label "p2"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 8
+    target 1
+    label "p1"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 0
+    target 4
+    label "p1"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 0
+    target 4
+    label "p2"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    class 0
+    decoupled 0
+  ]
+]
@@ -0,0 +1 @@
+ Pure box fusion: 3 box(es) eliminated
@@ -6,48 +6,44 @@ graph
   node
   [
     id 0
-    label "L"
-    func "L"
+    label "A"
+    func "A"
     static 0
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
     id 1
-    label "R"
-    func "R"
+    label "B,C,D,E"
+    func "B,C,D,E"
     static 0
-    pure 0
+    pure 1
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
     id 2
-    label "A"
-    func "A"
-    static 0
-    pure 0
-    location 0
-    tt 0
-  ]
-  node
-  [
-    id 3
-    label "B"
-    func "B"
+    label "F"
+    func "F"
     static 0
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   edge
   [
-    source 2
-    target 3
-    label "p_int"
+    source 0
+    target 1
+    label "a"
     nsrc "smx_null"
     ndst "smx_null"
     dsrc 0
@@ -60,12 +56,14 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
-    source 3
-    target 1
-    label "p2"
+    source 1
+    target 2
+    label "e"
     nsrc "smx_null"
     ndst "smx_null"
     dsrc 0
@@ -78,12 +76,14 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
-    source 0
+    source 1
     target 2
-    label "p1"
+    label "f"
     nsrc "smx_null"
     ndst "smx_null"
     dsrc 0
@@ -96,5 +96,7 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
 ]
@@ -0,0 +1 @@
+ Routing node fusion: 1 routing node(s) eliminated
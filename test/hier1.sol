@@ -0,0 +1,2 @@
+ Memory footprint: 4 channel(s) with declared message size in 160 bytes
+ Hierarchical output: 1 template(s) written to './/tpl'
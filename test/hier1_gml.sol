@@ -6,32 +6,35 @@ graph
   node
   [
     id 0
-    label "A"
-    func "fa"
+    label "S"
+    func "fs"
     static 0
     pure 0
     location 0
     tt 0
+    template ""
   ]
   node
   [
     id 1
-    label "B"
-    func "fb"
+    label "N"
+    func "smx_null"
     static 0
     pure 0
     location 0
     tt 0
+    template "N"
   ]
   node
   [
     id 2
-    label "C"
-    func "fc"
+    label "K"
+    func "fk"
     static 0
     pure 0
     location 0
     tt 0
+    template ""
   ]
   edge
   [
@@ -50,12 +53,15 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    msgsize 64
+    srcport "x"
+    dstport "x"
   ]
   edge
   [
     source 1
     target 2
-    label "z"
+    label "y"
     nsrc "smx_null"
     ndst "smx_null"
     dsrc 0
@@ -68,5 +74,8 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    msgsize 0
+    srcport "y"
+    dstport "y"
   ]
 ]
@@ -0,0 +1,197 @@
+Creator "igraph version 0.7.1 StreamixC"
+Version 1
+graph
+[
+  directed 1
+  ports "out y 3;in x 0"
+  node
+  [
+    id 0
+    label "P"
+    func "fp"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    farm 0
+    replica 0
+    farmrn 0
+    farmouter 0
+    replicaouter 0
+  ]
+  node
+  [
+    id 1
+    label "W"
+    func "fw"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    farm 1
+    replica 0
+    farmrn 0
+    farmouter 0
+    replicaouter 0
+  ]
+  node
+  [
+    id 2
+    label "W"
+    func "fw"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    farm 1
+    replica 1
+    farmrn 0
+    farmouter 0
+    replicaouter 0
+  ]
+  node
+  [
+    id 3
+    label "smx_rn_collect"
+    func "smx_rn_collect"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    farm 1
+    replica 0
+    farmrn 2
+    farmouter 0
+    replicaouter 0
+  ]
+  node
+  [
+    id 4
+    label "smx_rn_dispatch"
+    func "smx_rn_dispatch"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    farm 1
+    replica 0
+    farmrn 1
+    farmouter 0
+    replicaouter 0
+  ]
+  edge
+  [
+    source 1
+    target 3
+    label "y"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    msgsize 0
+    farm 1
+    replica 0
+    srcport "y"
+    dstport "y"
+  ]
+  edge
+  [
+    source 2
+    target 3
+    label "y"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    msgsize 0
+    farm 1
+    replica 1
+    srcport "y"
+    dstport "y"
+  ]
+  edge
+  [
+    source 4
+    target 1
+    label "z"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 1
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    msgsize 32
+    farm 1
+    replica 0
+    srcport "z"
+    dstport "z"
+  ]
+  edge
+  [
+    source 4
+    target 2
+    label "z"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 1
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    msgsize 32
+    farm 1
+    replica 1
+    srcport "z"
+    dstport "z"
+  ]
+  edge
+  [
+    source 0
+    target 4
+    label "z"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    msgsize 32
+    farm 0
+    replica 0
+    srcport "z"
+    dstport "z"
+  ]
+]
@@ -0,0 +1,15 @@
+ Latency report:
+  boxes without WCET: 0
+  ignored feedback channels: 0
+  worst-case latency per sink:
+   A(*) -> D(*): 25ms
+  critical path (25ms):
+   D(*) [3ms]
+    <- z [0ns]
+   C(*) [7ms]
+    <- y [0ns]
+   B(*) [4ms]
+    <- x [10ms]
+   A(*) [1ms]
+  unmet tt periods:
+   B(*): tt path 11ms exceeds period 10ms
@@ -12,6 +12,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -21,7 +23,9 @@ graph
     static 0
     pure 0
     location 0
-    tt 0
+    tt 3
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -31,7 +35,41 @@ graph
     static 0
     pure 0
     location 0
+    tt 3
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 3
+    label "D"
+    func "fd"
+    static 0
+    pure 0
+    location 0
     tt 0
+    fanin 1
+    fanout 1
+  ]
+  edge
+  [
+    source 1
+    target 2
+    label "y"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 10000000
+    sts 0
+    stns 10000000
+    type 1
+    dynsrc 0
+    dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -44,17 +82,19 @@ graph
     ddst 0
     len 1
     dts 0
-    dtns 0
+    dtns 10000000
     sts 0
     stns 0
-    type 0
+    type 1
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
-    source 1
-    target 2
+    source 2
+    target 3
     label "z"
     nsrc "smx_null"
     ndst "smx_null"
@@ -64,9 +104,11 @@ graph
     dts 0
     dtns 0
     sts 0
-    stns 0
-    type 0
+    stns 10000000
+    type 1
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
 ]
@@ -0,0 +1,22 @@
+{
+  "missing_wcet": 0,
+  "feedback_channels": 0,
+  "sinks": [
+    { "id": 3, "name": "D", "source": 0, "latency_ns": 25000000 }
+  ],
+  "critical_path": {
+    "latency_ns": 25000000,
+    "path": [
+      { "id": 3, "name": "D", "cost_ns": 3000000 },
+      { "edge": 2, "name": "z", "delay_ns": 0 },
+      { "id": 2, "name": "C", "cost_ns": 7000000 },
+      { "edge": 0, "name": "y", "delay_ns": 0 },
+      { "id": 1, "name": "B", "cost_ns": 4000000 },
+      { "edge": 1, "name": "x", "delay_ns": 10000000 },
+      { "id": 0, "name": "A", "cost_ns": 1000000 }
+    ]
+  },
+  "unmet_tt_periods": [
+    { "id": 1, "name": "B", "wcet_ns": 4000000, "path_ns": 11000000, "period_ns": 10000000 }
+  ]
+}
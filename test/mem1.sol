@@ -0,0 +1,2 @@
+ Memory layout: 3 channel(s) in 8768 bytes, arena of 2097152 bytes
+  1 channel(s) without message size, assumed 8 bytes
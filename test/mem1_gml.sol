@@ -3,6 +3,7 @@ Version 1
 graph
 [
   directed 1
+  memarena 2097152
   node
   [
     id 0
@@ -12,6 +13,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -22,6 +25,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -32,6 +37,20 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 3
+    label "D"
+    func "fd"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    fanin 1
+    fanout 1
   ]
   edge
   [
@@ -50,11 +69,41 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
+    msgsize 100
+    memwr 0
+    memrd 64
+    membuf 128
   ]
   edge
   [
     source 1
     target 2
+    label "y"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 4
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    class 0
+    decoupled 0
+    msgsize 2048
+    memwr 256
+    memrd 320
+    membuf 384
+  ]
+  edge
+  [
+    source 2
+    target 3
     label "z"
     nsrc "smx_null"
     ndst "smx_null"
@@ -68,5 +117,11 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
+    msgsize 8
+    memwr 8576
+    memrd 8640
+    membuf 8704
   ]
 ]
@@ -0,0 +1 @@
+ Memory footprint: 14 channel(s) with declared message size in 752 bytes
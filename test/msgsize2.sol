@@ -0,0 +1,2 @@
+test/msgsize2.smx: 8: error: conflicting message sizes of ports 'x' in 'A'(*) (64 bytes) and 'x' in 'B'(*) (32 bytes)
+ Error count: 1
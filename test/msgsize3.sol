@@ -0,0 +1,2 @@
+test/msgsize3.smx: 6: error: conflicting message sizes 32 and 64 of channels at routing node 'smx_rn'(*)
+ Error count: 1
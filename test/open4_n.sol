@@ -1,5 +1,4 @@
 test/open4_n.smx: 8: error: cannot connect open port 'x' in 'A'(*)
 test/open4_n.smx: 8: error: no port connection in serial combinition 'A(*).B(*)'
 test/open4_n.smx: 8: error: no port connection in serial combinition 'A(*).B(*)'
-test/open4_n.smx: 0: error: single mode in routing node 'smx_rn'(*)
- Error count: 4
+ Error count: 3
@@ -0,0 +1,4 @@
+ Priority inheritance: 3 vertex(es) raised
+   A(*): prio 4 -> smx_rn(*) -> B(*) -> C(*) [prio 10]
+   B(*): prio 8 -> C(*) [prio 10]
+   smx_rn(*): prio 6 -> B(*) -> C(*) [prio 10]
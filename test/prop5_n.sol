@@ -1,4 +1,3 @@
 test/prop5_n.smx: 5: error: unconnected port 'y' in 'A'(*) of serial combinition 'A.*'
  -> for bypassing, use operator ':' or a wrapper
-test/prop5_n.smx: 9: error: port 'y' in 'C'(*) is not connected
- Error count: 2
+ Error count: 1
@@ -1,4 +1,3 @@
 test/prop6_n.smx: 7: error: unconnected port 'y' in 'C'(*) of serial combinition 'C.*'
  -> for bypassing, use operator ':' or a wrapper
-test/prop6_n.smx: 9: error: port 'y' in 'A'(*) is not connected
- Error count: 2
+ Error count: 1
@@ -0,0 +1,6 @@
+test/renum1.smx: 14: warning: no port connection in serial combinition 'A1(*):B2(*)'. Use an abstract net instead of a composed net.
+test/renum1.smx: 14: warning: no port connection in serial combinition 'A2(*):B1(*)'. Use an abstract net instead of a composed net.
+test/renum1.smx: 14: warning: no port connection in serial combinition 'B1(*):C2(*)'. Use an abstract net instead of a composed net.
+test/renum1.smx: 14: warning: no port connection in serial combinition 'B2(*):C1(*)'. Use an abstract net instead of a composed net.
+ Renumbering: 4 vertex(es) moved, channel span 8 -> 4
+ Error count: 4
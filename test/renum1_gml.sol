@@ -0,0 +1,168 @@
+Creator "igraph version 0.7.1 StreamixC"
+Version 1
+graph
+[
+  directed 1
+  node
+  [
+    id 0
+    label "A1"
+    func "fa"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    origid 0
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 1
+    label "B1"
+    func "fb"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    origid 2
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 2
+    label "C1"
+    func "fc"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    origid 4
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 3
+    label "A2"
+    func "fa"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    origid 1
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 4
+    label "B2"
+    func "fb"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    origid 3
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 5
+    label "C2"
+    func "fc"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    origid 5
+    fanin 1
+    fanout 1
+  ]
+  edge
+  [
+    source 0
+    target 1
+    label "x1"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    origid 1
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 1
+    target 2
+    label "y1"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    origid 2
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 3
+    target 4
+    label "x2"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    origid 0
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 4
+    target 5
+    label "y2"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 0
+    type 0
+    dynsrc 0
+    dyndst 0
+    origid 3
+    class 0
+    decoupled 0
+  ]
+]
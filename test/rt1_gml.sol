@@ -12,6 +12,8 @@ graph
     pure 0
     location 0
     tt 1
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -22,6 +24,8 @@ graph
     pure 0
     location 0
     tt 1
+    fanin 1
+    fanout 1
   ]
   edge
   [
@@ -40,5 +44,7 @@ graph
     type 0
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
 ]
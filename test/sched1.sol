@@ -0,0 +1 @@
+ TT schedule: 2 group(s) written to './/sched1_schedule.json'
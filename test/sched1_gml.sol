@@ -0,0 +1,190 @@
+Creator "igraph version 0.7.1 StreamixC"
+Version 1
+graph
+[
+  directed 1
+  node
+  [
+    id 0
+    label "A"
+    func "fa"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 1
+    label "B"
+    func "fb"
+    static 0
+    pure 0
+    location 0
+    tt 3
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 2
+    label "C"
+    func "fc"
+    static 0
+    pure 0
+    location 0
+    tt 3
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 3
+    label "D"
+    func "fd"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 4
+    label "F"
+    func "ff"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 5
+    label "G"
+    func "fg"
+    static 0
+    pure 0
+    location 0
+    tt 3
+    fanin 1
+    fanout 1
+  ]
+  node
+  [
+    id 6
+    label "H"
+    func "fh"
+    static 0
+    pure 0
+    location 0
+    tt 0
+    fanin 1
+    fanout 1
+  ]
+  edge
+  [
+    source 0
+    target 1
+    label "x"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 10000000
+    sts 0
+    stns 0
+    type 1
+    dynsrc 0
+    dyndst 0
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 1
+    target 2
+    label "y"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 15000000
+    sts 0
+    stns 10000000
+    type 1
+    dynsrc 0
+    dyndst 0
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 2
+    target 3
+    label "z"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 15000000
+    type 1
+    dynsrc 0
+    dyndst 0
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 4
+    target 5
+    label "u"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 20000000
+    sts 0
+    stns 0
+    type 1
+    dynsrc 0
+    dyndst 0
+    class 0
+    decoupled 0
+  ]
+  edge
+  [
+    source 5
+    target 6
+    label "v"
+    nsrc "smx_null"
+    ndst "smx_null"
+    dsrc 0
+    ddst 0
+    len 1
+    dts 0
+    dtns 0
+    sts 0
+    stns 20000000
+    type 1
+    dynsrc 0
+    dyndst 0
+    class 0
+    decoupled 0
+  ]
+]
@@ -0,0 +1,28 @@
+{
+  "groups": [
+    {
+      "id": 0,
+      "hyperperiod_ns": 30000000,
+      "boxes": [
+        { "id": 1, "name": "B", "impl": "fb", "period_ns": 10000000, "offsets_ns": [0, 10000000, 20000000] },
+        { "id": 2, "name": "C", "impl": "fc", "period_ns": 15000000, "offsets_ns": [0, 15000000] }
+      ],
+      "table": [
+        { "offset_ns": 0, "release": [ 1, 2 ] },
+        { "offset_ns": 10000000, "release": [ 1 ] },
+        { "offset_ns": 15000000, "release": [ 2 ] },
+        { "offset_ns": 20000000, "release": [ 1 ] }
+      ]
+    },
+    {
+      "id": 4,
+      "hyperperiod_ns": 20000000,
+      "boxes": [
+        { "id": 5, "name": "G", "impl": "fg", "period_ns": 20000000, "offsets_ns": [0] }
+      ],
+      "table": [
+        { "offset_ns": 0, "release": [ 5 ] }
+      ]
+    }
+  ]
+}
@@ -12,6 +12,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   node
   [
@@ -22,6 +24,8 @@ graph
     pure 0
     location 0
     tt 0
+    fanin 1
+    fanout 1
   ]
   edge
   [
@@ -40,6 +44,8 @@ graph
     type 2
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
   edge
   [
@@ -58,5 +64,7 @@ graph
     type 2
     dynsrc 0
     dyndst 0
+    class 0
+    decoupled 0
   ]
 ]
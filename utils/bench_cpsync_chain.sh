@@ -0,0 +1,45 @@
+#!/bin/bash
+#
+# Benchmark the compiler on long chains of copy synchronizers.
+#
+# Each generated network is a serial chain of N wrapper instances. Each
+# wrapper bypasses its ports 'p1' and 'p2' through one copy synchronizer which
+# also feeds the box A. The copy synchronizer of a wrapper instance feeds the
+# one of the next instance with two channels, hence they cannot be merged and
+# the network has a chain of N routing nodes. The decoupling of the source
+# port has to travel along the whole chain.
+#
+# usage: utils/bench_cpsync_chain.sh [N ...]
+# run from the project root after 'make'
+
+SMXC=./smxc
+TMP=$(mktemp -d)
+
+if [ $# -eq 0 ]; then
+    set -- 100 200 400 800 1600
+fi
+
+for n in "$@"; do
+    file=$TMP/chain$n.smx
+    {
+        echo "S = box S( decoupled out p1, out p2 )"
+        echo "E = box E( in p1, in p2 )"
+        echo "wrapper W( up in p1(x), up in p2(x), down out p1(x),"
+        echo "        down out p2(x) ) {"
+        echo "    A = box A( in x )"
+        echo "    connect A"
+        echo "} net( up in x )"
+        printf "connect S"
+        for (( i = 0; i < n; i++ )); do
+            printf ".W"
+        done
+        echo ".E"
+    } > $file
+    mkdir -p $TMP/build$n
+    start=$(date +%s%N)
+    $SMXC -S -p $TMP/build$n $file > /dev/null
+    end=$(date +%s%N)
+    printf "N = %5d: %6d ms\n" $n $(( ( end - start ) / 1000000 ))
+done
+
+rm -rf $TMP
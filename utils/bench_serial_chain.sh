@@ -0,0 +1,39 @@
+#!/bin/bash
+#
+# Benchmark the compiler on long serial chains of boxes.
+#
+# Each generated network is a serial chain of N boxes connected by the port
+# 'a'. Every serial combination connects one pair of ports and closes them,
+# hence the cost of a composition should not grow with the number of ports
+# that were closed before.
+#
+# usage: utils/bench_serial_chain.sh [N ...]
+# run from the project root after 'make'
+
+SMXC=./smxc
+TMP=$(mktemp -d)
+
+if [ $# -eq 0 ]; then
+    set -- 1000 2000 4000 8000 16000
+fi
+
+for n in "$@"; do
+    file=$TMP/serial$n.smx
+    {
+        echo "S = box S( out a )"
+        echo "B = box B( up in a, down out a )"
+        echo "E = box E( in a )"
+        printf "connect S"
+        for (( i = 0; i < n; i++ )); do
+            printf ".B"
+        done
+        echo ".E"
+    } > $file
+    mkdir -p $TMP/build$n
+    start=$(date +%s%N)
+    $SMXC -S -p $TMP/build$n $file > /dev/null
+    end=$(date +%s%N)
+    printf "N = %5d: %6d ms\n" $n $(( ( end - start ) / 1000000 ))
+done
+
+rm -rf $TMP
@@ -0,0 +1,138 @@
+/**
+ * Benchmark the binding of user-defined SIAs to box signatures
+ *
+ * A box signature with P ports and a SIA with T transitions cycling through
+ * all ports of the signature are generated. The SIA is then bound to N box
+ * instances with smx2sia_update() and the average binding time is printed.
+ * Every binding is checked against the action names of the signature.
+ *
+ * usage: utils/bench_sia_update [P [T [N]]]
+ * build and run from the project root with 'make bench_sia'
+ *
+ * @file    bench_sia_update.c
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "smx2sia.h"
+
+// globals of the compiler, defined in main.c
+char* __src_file_name = "bench_sia_update";
+int __smxc_min_ch_len = 1;
+int __smxc_jobs = 1;
+int __smxc_max_errors = 0;
+int __smxc_time_criticality_prio[TIME_CTITICALITY_COUNT] = { 1, 1, 2, 3 };
+
+/******************************************************************************/
+virt_port_list_t* bench_ports_create( int count )
+{
+    int i;
+    char name[16];
+    virt_port_t* port;
+    virt_port_list_t* ports_rec = NULL;
+    virt_port_list_t* ports;
+
+    for( i = count - 1; i >= 0; i-- ) {
+        sprintf( name, "p%d", i );
+        port = calloc( 1, sizeof( virt_port_t ) );
+        port->name = strdup( name );
+        port->attr_mode = ( i % 2 ) ? PORT_MODE_OUT : PORT_MODE_IN;
+        port->edge_id = i;
+        ports = malloc( sizeof( virt_port_list_t ) );
+        ports->idx = i;
+        ports->port = port;
+        ports->next = ports_rec;
+        ports_rec = ports;
+    }
+    return ports_rec;
+}
+
+/******************************************************************************/
+void bench_ports_destroy( virt_port_list_t* ports_rec )
+{
+    virt_port_list_t* ports;
+
+    while( ports_rec != NULL ) {
+        ports = ports_rec;
+        ports_rec = ports_rec->next;
+        free( ( char* )ports->port->name );
+        free( ports->port );
+        free( ports );
+    }
+}
+
+/******************************************************************************/
+sia_t* bench_sia_create( virt_port_list_t* ports_rec, int count )
+{
+    int i;
+    virt_port_list_t* ports = ports_rec;
+    sia_t* sia = sia_create( NULL, NULL );
+
+    // a ring of states, the transitions cycle through the signature
+    igraph_add_vertices( &sia->g, count, NULL );
+    for( i = 0; i < count; i++ ) {
+        smx2sia_add_transition( &sia->g, ports->port, i, ( i + 1 ) % count,
+                -1 );
+        ports = ( ports->next == NULL ) ? ports_rec : ports->next;
+    }
+    return sia;
+}
+
+/******************************************************************************/
+int bench_sia_check( igraph_t* g, virt_port_list_t* ports_rec, int vid )
+{
+    int eid, err = 0;
+    char* action;
+    virt_port_list_t* ports = ports_rec;
+
+    for( eid = 0; eid < igraph_ecount( g ); eid++ ) {
+        action = sia_create_action_name( vid, ports->port->edge_id );
+        if( strcmp( igraph_cattribute_EAS( g, G_SIA_NAME, eid ), action ) != 0 )
+            err++;
+        free( action );
+        ports = ( ports->next == NULL ) ? ports_rec : ports->next;
+    }
+    return err;
+}
+
+/******************************************************************************/
+int main( int argc, char **argv )
+{
+    int port_count = ( argc > 1 ) ? atoi( argv[1] ) : 500;
+    int trans_count = ( argc > 2 ) ? atoi( argv[2] ) : 10000;
+    int inst_count = ( argc > 3 ) ? atoi( argv[3] ) : 10;
+    int vid, err = 0;
+    double ms;
+    struct timespec start, end;
+    virt_port_list_t* ports;
+    sia_t* sia;
+
+    if( port_count < 1 || trans_count < 1 || inst_count < 1 ) {
+        fprintf( stderr, "usage: %s [P [T [N]]]\n", argv[0] );
+        return 1;
+    }
+    igraph_i_set_attribute_table( &igraph_cattribute_table );
+    ports = bench_ports_create( port_count );
+    sia = bench_sia_create( ports, trans_count );
+
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    for( vid = 0; vid < inst_count; vid++ )
+        smx2sia_update( &sia->g, ports, vid );
+    clock_gettime( CLOCK_MONOTONIC, &end );
+    // only the last binding survives in the graph
+    err = bench_sia_check( &sia->g, ports, inst_count - 1 );
+
+    ms = ( end.tv_sec - start.tv_sec ) * 1e3
+        + ( end.tv_nsec - start.tv_nsec ) / 1e6;
+    printf( "%d ports, %d transitions: %.2f ms per binding (%d bindings)\n",
+            port_count, trans_count, ms / inst_count, inst_count );
+    if( err > 0 )
+        fprintf( stderr, "%d transitions are bound to a wrong action\n", err );
+
+    sia_destroy( sia );
+    bench_ports_destroy( ports );
+    return ( err > 0 );
+}